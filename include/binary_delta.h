@@ -0,0 +1,413 @@
+#ifndef BINARY_DELTA_H
+#define BINARY_DELTA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "block_diff.h"
+#include "byte_compare.h"
+#include "hex_writer.h"
+
+/*
+ * A compact delta that rebuilds a target buffer from a base buffer.
+ *
+ * The delta is a sequence of copy, insert and replace operations over a
+ * cursor into the base. Integers are LEB128 varints:
+ *
+ *   "bdlt"                              magic
+ *   varint base size, varint target size
+ *   per operation:
+ *     varint length << 2 | op
+ *     op 0, copy:    varint zigzag(source - cursor); the base bytes
+ *                    [source, source + length) are appended and the cursor
+ *                    moves to source + length
+ *     op 1, insert:  length literal bytes, the cursor stays
+ *     op 2, replace: length literal bytes, the cursor moves on by length
+ *
+ * The operations end when the target is complete. Applying is one memcpy
+ * per operation, so it runs at memcpy speed for all but tiny operations.
+ */
+
+enum class delta_op : std::uint8_t { copy = 0, insert = 1, replace = 2 };
+
+inline void put_varint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+// Reads a varint at *p, advancing it; false if it runs past end
+inline bool get_varint(const std::uint8_t*& p, const std::uint8_t* end,
+                       std::uint64_t& value) noexcept {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p == end) {
+            return false;
+        }
+        std::uint8_t byte = *p++;
+        value |= std::uint64_t(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * \brief Builds a delta one operation at a time; adjacent operations that
+ * continue each other are joined.
+ */
+class delta_writer {
+public:
+    delta_writer(std::size_t base_size, std::size_t target_size) {
+        out_.insert(out_.end(), {'b', 'd', 'l', 't'});
+        put_varint(out_, base_size);
+        put_varint(out_, target_size);
+    }
+
+    void copy(std::size_t source, std::size_t length) {
+        if (length == 0) {
+            return;
+        }
+        if (op_ == delta_op::copy && source == cursor_) {
+            length_ += length;
+        } else {
+            flush();
+            op_ = delta_op::copy;
+            length_ = length;
+            source_ = source;
+        }
+        cursor_ = source + length;
+    }
+
+    void insert(const std::uint8_t* bytes, std::size_t length) {
+        literal(delta_op::insert, bytes, length);
+    }
+
+    void replace(const std::uint8_t* bytes, std::size_t length) {
+        literal(delta_op::replace, bytes, length);
+        cursor_ += length;
+    }
+
+    // The finished delta
+    std::vector<std::uint8_t> finish() {
+        flush();
+        return std::move(out_);
+    }
+
+private:
+    void literal(delta_op op, const std::uint8_t* bytes, std::size_t length) {
+        if (length == 0) {
+            return;
+        }
+        if (op_ != op) {
+            flush();
+            op_ = op;
+        }
+        literals_.insert(literals_.end(), bytes, bytes + length);
+        length_ += length;
+    }
+
+    void flush() {
+        if (length_ == 0) {
+            return;
+        }
+        put_varint(out_, std::uint64_t(length_) << 2 | static_cast<std::uint64_t>(op_));
+        if (op_ == delta_op::copy) {
+            // Stored relative to the cursor the written operations leave,
+            // so sequential copies cost a single byte here
+            std::int64_t delta = static_cast<std::int64_t>(source_) -
+                                 static_cast<std::int64_t>(written_cursor_);
+            put_varint(out_, static_cast<std::uint64_t>(delta) << 1 ^
+                                 static_cast<std::uint64_t>(delta >> 63));
+            written_cursor_ = source_ + length_;
+        } else {
+            out_.insert(out_.end(), literals_.begin(), literals_.end());
+            literals_.clear();
+            if (op_ == delta_op::replace) {
+                written_cursor_ += length_;
+            }
+        }
+        length_ = 0;
+    }
+
+    std::vector<std::uint8_t> out_;
+    std::vector<std::uint8_t> literals_;
+    delta_op op_ = delta_op::copy;
+    std::size_t length_ = 0;
+    std::size_t source_ = 0;
+    // The base cursor after the operations added so far, and after those
+    // written to out_
+    std::size_t cursor_ = 0;
+    std::size_t written_cursor_ = 0;
+};
+
+/**
+ * \brief A delta from the matches of block_diff: matches become copies and
+ * the new bytes between them literals. Literals become replaces as far as
+ * that lines the cursor up with the next copy.
+ */
+inline std::vector<std::uint8_t> encode_delta(const std::uint8_t* /* base */,
+                                              std::size_t base_size, const std::uint8_t* target,
+                                              std::size_t target_size,
+                                              const std::vector<block_match>& matches) {
+    delta_writer writer(base_size, target_size);
+    std::size_t cursor = 0;
+    std::size_t pos = 0;
+    auto literals = [&](std::size_t end, std::size_t next_source) {
+        std::size_t gap = end - pos;
+        std::size_t replaced = next_source >= cursor ? std::min(gap, next_source - cursor) : 0;
+        writer.replace(target + pos, replaced);
+        writer.insert(target + pos + replaced, gap - replaced);
+        cursor += replaced;
+        pos = end;
+    };
+    for (const block_match& m : matches) {
+        literals(m.new_offset, m.old_offset);
+        writer.copy(m.old_offset, m.length);
+        cursor = m.old_end();
+        pos = m.new_end();
+    }
+    literals(target_size, base_size);
+    return writer.finish();
+}
+
+/**
+ * \brief A shift-tolerant delta, from block_diff with the given options.
+ */
+inline std::vector<std::uint8_t> encode_delta(const std::uint8_t* base, std::size_t base_size,
+                                              const std::uint8_t* target, std::size_t target_size,
+                                              const block_diff_options& options = {}) {
+    return encode_delta(base, base_size, target, target_size,
+                        block_diff(base, base_size, target, target_size, options));
+}
+
+/**
+ * \brief A delta from a positional comparison: differing runs become
+ * replaces and bytes past the end of the base an insert. Cheaper to build
+ * than encode_delta when the buffers differ in place.
+ */
+inline std::vector<std::uint8_t> encode_positional_delta(const std::uint8_t* base,
+                                                         std::size_t base_size,
+                                                         const std::uint8_t* target,
+                                                         std::size_t target_size) {
+    // An equal gap this short costs less as literals than as a copy
+    constexpr std::size_t min_copy = 4;
+    delta_writer writer(base_size, target_size);
+    std::size_t common = std::min(base_size, target_size);
+    std::size_t pos = 0;
+    std::size_t replace_from = 0;
+    for_each_mismatch_range(base, target, common, [&](mismatch_range r) {
+        if (r.offset - pos >= min_copy || pos == 0) {
+            writer.replace(target + replace_from, pos - replace_from);
+            writer.copy(pos, r.offset - pos);
+            replace_from = r.offset;
+        }
+        pos = r.end();
+    });
+    writer.replace(target + replace_from, pos - replace_from);
+    writer.copy(pos, common - pos);
+    writer.insert(target + common, target_size - common);
+    return writer.finish();
+}
+
+/**
+ * \brief Reads the base and target sizes from the header of a delta.
+ */
+inline bool read_delta_header(const std::uint8_t* delta, std::size_t delta_size,
+                              std::size_t& base_size, std::size_t& target_size,
+                              const std::uint8_t** ops = nullptr) noexcept {
+    const std::uint8_t* p = delta;
+    const std::uint8_t* end = delta + delta_size;
+    std::uint64_t base_value;
+    std::uint64_t target_value;
+    if (delta_size < 4 || std::memcmp(delta, "bdlt", 4) != 0) {
+        return false;
+    }
+    p += 4;
+    if (!get_varint(p, end, base_value) || !get_varint(p, end, target_value)) {
+        return false;
+    }
+    base_size = static_cast<std::size_t>(base_value);
+    target_size = static_cast<std::size_t>(target_value);
+    if (ops != nullptr) {
+        *ops = p;
+    }
+    return true;
+}
+
+/**
+ * \brief Calls f(op, cursor, position, length, literals) for every
+ * operation of a delta, where cursor is the base offset the operation reads
+ * or replaces at, position its offset in the target and literals its bytes
+ * (nullptr for a copy). False if the delta is malformed or does not fit a
+ * base of base_size bytes; f may have been called for a prefix then.
+ */
+template <typename F>
+bool for_each_delta_op(const std::uint8_t* delta, std::size_t delta_size, std::size_t base_size,
+                       F&& f) {
+    std::size_t expected_base;
+    std::size_t target_size;
+    const std::uint8_t* p;
+    if (!read_delta_header(delta, delta_size, expected_base, target_size, &p) ||
+        expected_base != base_size) {
+        return false;
+    }
+    const std::uint8_t* end = delta + delta_size;
+    std::size_t cursor = 0;
+    std::size_t pos = 0;
+    while (pos < target_size) {
+        std::uint64_t header;
+        if (!get_varint(p, end, header)) {
+            return false;
+        }
+        std::uint64_t length = header >> 2;
+        if (length == 0 || length > target_size - pos) {
+            return false;
+        }
+        switch (static_cast<delta_op>(header & 3)) {
+            case delta_op::copy: {
+                std::uint64_t zigzag;
+                if (!get_varint(p, end, zigzag)) {
+                    return false;
+                }
+                std::uint64_t move = (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+                std::uint64_t source = cursor + move;
+                if (source > base_size || length > base_size - source) {
+                    return false;
+                }
+                f(delta_op::copy, static_cast<std::size_t>(source), pos,
+                  static_cast<std::size_t>(length), static_cast<const std::uint8_t*>(nullptr));
+                cursor = static_cast<std::size_t>(source + length);
+                break;
+            }
+            case delta_op::insert:
+            case delta_op::replace: {
+                if (length > static_cast<std::size_t>(end - p)) {
+                    return false;
+                }
+                delta_op op = static_cast<delta_op>(header & 3);
+                if (op == delta_op::replace && length > base_size - cursor) {
+                    return false;
+                }
+                f(op, cursor, pos, static_cast<std::size_t>(length), p);
+                p += length;
+                if (op == delta_op::replace) {
+                    cursor += static_cast<std::size_t>(length);
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+        pos += static_cast<std::size_t>(length);
+    }
+    return p == end;
+}
+
+/**
+ * \brief Rebuilds the target of a delta into out, which must hold the
+ * target size given by read_delta_header. False if the delta is malformed
+ * or was made from a base of another size.
+ */
+inline bool apply_delta(const std::uint8_t* base, std::size_t base_size,
+                        const std::uint8_t* delta, std::size_t delta_size, std::uint8_t* out,
+                        std::size_t out_size) {
+    std::size_t expected_base;
+    std::size_t target_size;
+    if (!read_delta_header(delta, delta_size, expected_base, target_size) ||
+        target_size != out_size) {
+        return false;
+    }
+    return for_each_delta_op(delta, delta_size, base_size,
+                             [&](delta_op op, std::size_t cursor, std::size_t pos,
+                                 std::size_t length, const std::uint8_t* literals) {
+                                 std::memcpy(out + pos, op == delta_op::copy ? base + cursor
+                                                                             : literals,
+                                             length);
+                             });
+}
+
+/**
+ * \brief apply_delta into a vector sized to the target. The delta is checked
+ * before the vector grows, so a malformed one cannot make it allocate its
+ * claimed target size; false also if that size cannot be allocated.
+ */
+inline bool apply_delta(const std::uint8_t* base, std::size_t base_size,
+                        const std::uint8_t* delta, std::size_t delta_size,
+                        std::vector<std::uint8_t>& target) {
+    std::size_t expected_base;
+    std::size_t target_size;
+    if (!read_delta_header(delta, delta_size, expected_base, target_size) ||
+        expected_base != base_size) {
+        return false;
+    }
+    auto check = [](delta_op, std::size_t, std::size_t, std::size_t, const std::uint8_t*) {};
+    if (!for_each_delta_op(delta, delta_size, base_size, check)) {
+        return false;
+    }
+    try {
+        target.resize(target_size);
+    } catch (const std::bad_alloc&) {
+        return false;
+    } catch (const std::length_error&) {
+        return false;
+    }
+    return apply_delta(base, base_size, delta, delta_size, target.data(), target.size());
+}
+
+/**
+ * \brief Writes the operations of a delta as text, one line per operation
+ * followed by its bytes in lines of 16: "-" lines for the base bytes a
+ * replace overwrites (when base is given), "+" lines for literals. False if
+ * the delta is malformed.
+ */
+inline bool dump_delta(const std::uint8_t* base, std::size_t base_size,
+                       const std::uint8_t* delta, std::size_t delta_size, std::ostream& output) {
+    static const char* const names[] = {"copy   ", "insert ", "replace"};
+    HexWriter out(output);
+    auto bytes = [&](char sign, const std::uint8_t* p, std::size_t length) {
+        for (std::size_t i = 0; i < length; i += 16) {
+            out << "  ";
+            out.append(&sign, 1);
+            for (std::size_t j = i; j < std::min(length, i + 16); ++j) {
+                out << " ";
+                out.hex_byte(p[j]);
+            }
+            out << "\n";
+        }
+    };
+    std::size_t expected_base;
+    std::size_t target_size;
+    if (read_delta_header(delta, delta_size, expected_base, target_size)) {
+        out << "delta: ";
+        out.dec(delta_size) << " bytes, base ";
+        out.dec(expected_base) << " bytes, target ";
+        out.dec(target_size) << " bytes\n";
+    }
+    return for_each_delta_op(delta, delta_size, base_size,
+                             [&](delta_op op, std::size_t cursor, std::size_t pos,
+                                 std::size_t length, const std::uint8_t* literals) {
+                                 out << names[static_cast<int>(op)] << "  base ";
+                                 out.hex(cursor, 8) << "  target ";
+                                 out.hex(pos, 8) << "  ";
+                                 out.dec(length) << (length == 1 ? " byte\n" : " bytes\n");
+                                 if (op == delta_op::replace && base != nullptr) {
+                                     bytes('-', base + cursor, length);
+                                 }
+                                 if (op != delta_op::copy) {
+                                     bytes('+', literals, length);
+                                 }
+                             });
+}
+
+#endif // BINARY_DELTA_H
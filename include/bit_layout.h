@@ -0,0 +1,210 @@
+#ifndef BIT_LAYOUT_H
+#define BIT_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "check_env.h"
+#include "seq.h"
+
+// pext/pdep are 64-bit only. Kernels compiled with CHECK_ENV_TARGET("bmi2")
+// may use them even when the translation unit is not built with -mbmi2.
+#if CHECK_ENV_X86 && (defined(__x86_64__) || defined(_M_X64))
+#include <immintrin.h>
+#define TMPL_LIB_HAS_PEXT_KERNEL 1
+#else
+#define TMPL_LIB_HAS_PEXT_KERNEL 0
+#endif
+
+#if TMPL_LIB_HAS_PEXT_KERNEL && defined(__BMI2__)
+#define TMPL_LIB_HAS_BMI2 1
+#else
+#define TMPL_LIB_HAS_BMI2 0
+#endif
+
+/**
+ * \brief Portable pext: the bits of x selected by mask, packed into the low bits.
+ */
+constexpr std::uint64_t pext_portable(std::uint64_t x, std::uint64_t mask) noexcept {
+    std::uint64_t result = 0;
+    for (std::uint64_t bit = 1; mask != 0; bit <<= 1) {
+        if (x & mask & (~mask + 1)) {
+            result |= bit;
+        }
+        mask &= mask - 1;
+    }
+    return result;
+}
+
+/**
+ * \brief Portable pdep: the low bits of x spread to the positions set in mask.
+ */
+constexpr std::uint64_t pdep_portable(std::uint64_t x, std::uint64_t mask) noexcept {
+    std::uint64_t result = 0;
+    for (std::uint64_t bit = 1; mask != 0; bit <<= 1) {
+        if (x & bit) {
+            result |= mask & (~mask + 1);
+        }
+        mask &= mask - 1;
+    }
+    return result;
+}
+
+constexpr std::uint64_t low_bits_mask(int width) noexcept {
+    return width >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+}
+
+template <std::size_t... Is>
+constexpr bool is_strictly_ascending() noexcept {
+    constexpr std::size_t count = sizeof...(Is);
+    constexpr std::size_t values[count + 1] = {Is..., 0};
+    for (std::size_t i = 1; i < count; ++i) {
+        if (values[i - 1] >= values[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if TMPL_LIB_HAS_PEXT_KERNEL
+CHECK_ENV_TARGET("bmi2")
+inline void pext_kernel_bmi2(const std::uint64_t* words, std::uint64_t* keys, std::size_t n,
+                             std::uint64_t mask) {
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = _pext_u64(words[i], mask);
+    }
+}
+
+CHECK_ENV_TARGET("bmi2")
+inline void pdep_kernel_bmi2(std::uint64_t* words, const std::uint64_t* keys, std::size_t n,
+                             std::uint64_t mask) {
+    for (std::size_t i = 0; i < n; ++i) {
+        words[i] = (words[i] & ~mask) | _pdep_u64(keys[i], mask);
+    }
+}
+#endif
+
+// BMI2 shares the avx2 tier of check_env. The kernel slot stays empty when
+// pext is unavailable, or when it is compiled in and gather inlines it anyway.
+#if TMPL_LIB_HAS_PEXT_KERNEL && !TMPL_LIB_HAS_BMI2
+#define TMPL_LIB_BMI2_KERNEL(fn) &fn
+#else
+#define TMPL_LIB_BMI2_KERNEL(fn) nullptr
+#endif
+
+/**
+ * \brief Fields of the given widths packed into one 64-bit word, field 0 in
+ * the least significant bits.
+ *
+ * gather<Is...> collects the selected fields into a compact key (field Is[0]
+ * in the low bits) and scatter<Is...> writes a key back; the selected fields
+ * must be given in ascending order. The mask of the selected fields is a
+ * compile-time constant built from the seq.h prefix sums, so with BMI2 each
+ * call is a single pext or pdep. Otherwise each field costs a constant shift
+ * and mask; the bulk gather_n/scatter_n then still use pext/pdep when the
+ * running CPU has them (note that pext and pdep are microcoded and slow on
+ * AMD CPUs before Zen 3).
+ *
+ * \tparam Bits The width of each field in bits.
+ */
+template <int... Bits>
+struct bit_layout {
+    static constexpr std::size_t field_count = sizeof...(Bits);
+    static constexpr int total_bits = (Bits + ... + 0);
+    static_assert(((Bits > 0) && ...), "Field widths must be positive");
+    static_assert(total_bits <= 64, "Fields must fit in a 64-bit word");
+
+    template <std::size_t I>
+    static constexpr int offset = total_seq_helper<Bits...>::template gen_total_at<I>();
+
+    template <std::size_t I>
+    static constexpr int width = get_value_at<I, Bits...>;
+
+    template <std::size_t I>
+    static constexpr std::uint64_t field_mask = low_bits_mask(width<I>) << offset<I>;
+
+    template <std::size_t... Is>
+    static constexpr std::uint64_t mask = (field_mask<Is> | ... | std::uint64_t(0));
+
+    template <std::size_t... Is>
+    static constexpr std::uint64_t gather_portable(std::uint64_t word) noexcept {
+        static_assert(is_strictly_ascending<Is...>(), "Fields must be given in ascending order");
+        std::uint64_t key = 0;
+        int shift = 0;
+        ((key |= ((word >> offset<Is>) & low_bits_mask(width<Is>)) << shift, shift += width<Is>),
+         ...);
+        return key;
+    }
+
+    template <std::size_t... Is>
+    static constexpr std::uint64_t scatter_portable(std::uint64_t word,
+                                                    std::uint64_t key) noexcept {
+        static_assert(is_strictly_ascending<Is...>(), "Fields must be given in ascending order");
+        word &= ~mask<Is...>;
+        int shift = 0;
+        ((word |= ((key >> shift) & low_bits_mask(width<Is>)) << offset<Is>, shift += width<Is>),
+         ...);
+        return word;
+    }
+
+    template <std::size_t... Is>
+    static std::uint64_t gather(std::uint64_t word) noexcept {
+#if TMPL_LIB_HAS_BMI2
+        static_assert(is_strictly_ascending<Is...>(), "Fields must be given in ascending order");
+        return _pext_u64(word, mask<Is...>);
+#else
+        return gather_portable<Is...>(word);
+#endif
+    }
+
+    template <std::size_t... Is>
+    static std::uint64_t scatter(std::uint64_t word, std::uint64_t key) noexcept {
+#if TMPL_LIB_HAS_BMI2
+        static_assert(is_strictly_ascending<Is...>(), "Fields must be given in ascending order");
+        return (word & ~mask<Is...>) | _pdep_u64(key, mask<Is...>);
+#else
+        return scatter_portable<Is...>(word, key);
+#endif
+    }
+
+    /**
+     * \brief keys[i] = gather<Is...>(words[i]) for i in [0, n).
+     */
+    template <std::size_t... Is>
+    static void gather_n(const std::uint64_t* words, std::uint64_t* keys, std::size_t n) {
+        static const check_env::kernel<void(const std::uint64_t*, std::uint64_t*, std::size_t,
+                                            std::uint64_t)>
+            kernel({&gather_loop<Is...>, nullptr, TMPL_LIB_BMI2_KERNEL(pext_kernel_bmi2)});
+        kernel(words, keys, n, mask<Is...>);
+    }
+
+    /**
+     * \brief words[i] = scatter<Is...>(words[i], keys[i]) for i in [0, n).
+     */
+    template <std::size_t... Is>
+    static void scatter_n(std::uint64_t* words, const std::uint64_t* keys, std::size_t n) {
+        static const check_env::kernel<void(std::uint64_t*, const std::uint64_t*, std::size_t,
+                                            std::uint64_t)>
+            kernel({&scatter_loop<Is...>, nullptr, TMPL_LIB_BMI2_KERNEL(pdep_kernel_bmi2)});
+        kernel(words, keys, n, mask<Is...>);
+    }
+
+private:
+    template <std::size_t... Is>
+    static void gather_loop(const std::uint64_t* words, std::uint64_t* keys, std::size_t n,
+                            std::uint64_t) {
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = gather<Is...>(words[i]);
+        }
+    }
+
+    template <std::size_t... Is>
+    static void scatter_loop(std::uint64_t* words, const std::uint64_t* keys, std::size_t n,
+                             std::uint64_t) {
+        for (std::size_t i = 0; i < n; ++i) {
+            words[i] = scatter<Is...>(words[i], keys[i]);
+        }
+    }
+};
+
+#endif // BIT_LAYOUT_H
@@ -0,0 +1,352 @@
+#ifndef BLOCK_DIFF_H
+#define BLOCK_DIFF_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "byte_compare.h"
+
+/*
+ * A diff that survives inserted, deleted and moved bytes.
+ *
+ * Positional comparison reports everything after an inserted byte as
+ * different. Here the old buffer is cut into blocks of a fixed size whose
+ * hashes go into an index, and the new buffer is scanned with a rolling
+ * hash of the same width (rsync style). Where the hash of the window at some
+ * position is found in the index and the bytes agree, the match is extended
+ * backwards and then forwards with find_mismatch, and the scan continues
+ * behind it. Between matches the window moves one byte at a time for a
+ * multiply and an add, so the whole diff is linear in the input size.
+ *
+ * The index is the only allocation that grows with the input. It holds one
+ * 8-byte slot per old block at a load factor of at most one half, and the
+ * block size is doubled until it fits the memory budget.
+ */
+
+/**
+ * \brief A stretch of the new buffer that equals a stretch of the old one.
+ */
+struct block_match {
+    std::size_t old_offset;
+    std::size_t new_offset;
+    std::size_t length;
+
+    std::size_t old_end() const noexcept { return old_offset + length; }
+    std::size_t new_end() const noexcept { return new_offset + length; }
+
+    friend bool operator==(const block_match& x, const block_match& y) noexcept {
+        return x.old_offset == y.old_offset && x.new_offset == y.new_offset &&
+               x.length == y.length;
+    }
+};
+
+struct block_diff_options {
+    // Bytes per indexed block; 0 starts from min_block_size. The size is
+    // doubled until the index fits memory_budget, explicit sizes included.
+    std::size_t block_size = 0;
+    std::size_t min_block_size = 32;
+    std::size_t memory_budget = std::size_t(64) << 20;
+};
+
+/**
+ * \brief The index of the old buffer: block hashes in an open-addressing
+ * table with linear probing.
+ */
+class block_index {
+public:
+    static constexpr std::uint64_t multiplier = 0x100000001b3ull;
+
+    struct slot {
+        std::uint32_t check;  // high half of the hash
+        std::uint32_t block;  // block number + 1; 0 marks an empty slot
+    };
+
+    // Bytes of index for blocks old blocks
+    static std::size_t index_bytes(std::size_t blocks) noexcept {
+        return table_size(blocks) * sizeof(slot);
+    }
+
+    // Most blocks an index can number; slots hold block + 1 in 32 bits
+    static constexpr std::size_t max_blocks = 0xfffffffeu;
+
+    // The block size that options give for an old buffer of old_size bytes
+    static std::size_t choose_block_size(std::size_t old_size, const block_diff_options& options) {
+        std::size_t size = std::max<std::size_t>(
+            options.block_size != 0 ? options.block_size : options.min_block_size, 1);
+        while ((old_size / size > max_blocks ||
+                index_bytes(old_size / size) > options.memory_budget) &&
+               size < old_size) {
+            size *= 2;
+        }
+        return size;
+    }
+
+    static std::uint64_t hash(const std::uint8_t* p, std::size_t n) noexcept {
+        std::uint64_t h = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            h = h * multiplier + p[i] + 1;
+        }
+        return h;
+    }
+
+    block_index(const std::uint8_t* old_data, std::size_t old_size, std::size_t block_size)
+        : data_(old_data), size_(old_size), block_size_(block_size) {
+        std::size_t blocks = block_size == 0 ? 0 : old_size / block_size;
+        if (blocks > max_blocks) {
+            throw std::length_error("block_index: too many blocks");
+        }
+        table_.resize(table_size(blocks));
+        shift_ = 64;
+        for (std::size_t n = table_.size(); n > 1; n >>= 1) {
+            --shift_;
+        }
+        for (std::size_t k = 0; k < blocks; ++k) {
+            const std::uint8_t* block = old_data + k * block_size;
+            std::uint64_t h = hash(block, block_size);
+            std::size_t i = home(h);
+            for (;; i = (i + 1) & (table_.size() - 1)) {
+                slot& s = table_[i];
+                if (s.block == 0) {
+                    s = {check(h), static_cast<std::uint32_t>(k + 1)};
+                    break;
+                }
+                // Keep the first of several equal blocks; runs of equal
+                // blocks would otherwise make the probe chains quadratic
+                if (s.check == check(h) && std::memcmp(data_ + (s.block - 1) * block_size_,
+                                                       block, block_size_) == 0) {
+                    break;
+                }
+            }
+        }
+    }
+
+    std::size_t block_size() const noexcept { return block_size_; }
+
+    // The old offset of a block equal to the block_size() bytes at p,
+    // whose hash is h, or size_ if there is none
+    std::size_t find(std::uint64_t h, const std::uint8_t* p) const noexcept {
+        if (table_.empty()) {
+            return size_;
+        }
+        for (std::size_t i = home(h);; i = (i + 1) & (table_.size() - 1)) {
+            const slot& s = table_[i];
+            if (s.block == 0) {
+                return size_;
+            }
+            std::size_t offset = (s.block - 1) * block_size_;
+            if (s.check == check(h) && std::memcmp(data_ + offset, p, block_size_) == 0) {
+                return offset;
+            }
+        }
+    }
+
+private:
+    static std::size_t table_size(std::size_t blocks) noexcept {
+        if (blocks == 0) {
+            return 0;
+        }
+        std::size_t size = 2;
+        while (size < 2 * blocks) {
+            size *= 2;
+        }
+        return size;
+    }
+
+    std::size_t home(std::uint64_t h) const noexcept {
+        return static_cast<std::size_t>((h * 0x9e3779b97f4a7c15ull) >> shift_);
+    }
+
+    static std::uint32_t check(std::uint64_t h) noexcept {
+        return static_cast<std::uint32_t>(h >> 32);
+    }
+
+    const std::uint8_t* data_;
+    std::size_t size_;
+    std::size_t block_size_;
+    int shift_ = 64;
+    std::vector<slot> table_;
+};
+
+/**
+ * \brief Calls f(block_match) for maximal matches covering as much of the
+ * new buffer as the block index finds, in ascending new_offset order.
+ *
+ * Matches do not overlap in the new buffer; they may overlap or appear in
+ * any order in the old one. A match is at least one block long, except
+ * that matches are extended backwards into unmatched bytes.
+ */
+template <typename F>
+void for_each_block_match(const std::uint8_t* old_data, std::size_t old_size,
+                          const std::uint8_t* new_data, std::size_t new_size, F&& f,
+                          const block_diff_options& options = {}) {
+    std::size_t b = block_index::choose_block_size(old_size, options);
+    if (b == 0 || old_size < b || new_size < b) {
+        return;
+    }
+    block_index index(old_data, old_size, b);
+
+    // multiplier^b, to take the outgoing byte off the rolling hash
+    std::uint64_t top = 1;
+    for (std::size_t i = 0; i < b; ++i) {
+        top *= block_index::multiplier;
+    }
+
+    block_match pending{0, 0, 0};
+    std::size_t j = 0;
+    std::uint64_t h = 0;
+    bool rehash = true;
+    while (j + b <= new_size) {
+        if (rehash) {
+            h = block_index::hash(new_data + j, b);
+            rehash = false;
+        }
+        std::size_t found = index.find(h, new_data + j);
+        if (found != old_size) {
+            // Prefer the old block on the diagonal of the last match, so
+            // repeated content keeps its alignment
+            std::size_t diagonal = pending.old_end() + (j - pending.new_end());
+            if (pending.length != 0 && diagonal != found && diagonal + b <= old_size &&
+                std::memcmp(old_data + diagonal, new_data + j, b) == 0) {
+                found = diagonal;
+            }
+            std::size_t back = 0;
+            while (j - back > pending.new_end() && found > back &&
+                   old_data[found - back - 1] == new_data[j - back - 1]) {
+                ++back;
+            }
+            std::size_t forward =
+                b + find_mismatch(old_data + found + b, new_data + j + b,
+                                  std::min(old_size - found - b, new_size - j - b));
+            block_match match{found - back, j - back, back + forward};
+            if (pending.length != 0 && pending.old_end() == match.old_offset &&
+                pending.new_end() == match.new_offset) {
+                pending.length += match.length;
+            } else {
+                if (pending.length != 0) {
+                    f(pending);
+                }
+                pending = match;
+            }
+            j = match.new_end();
+            rehash = true;
+            continue;
+        }
+        if (j + b == new_size) {
+            break;
+        }
+        h = h * block_index::multiplier + new_data[j + b] + 1 - top * (new_data[j] + 1u);
+        ++j;
+    }
+    if (pending.length != 0) {
+        f(pending);
+    }
+}
+
+/**
+ * \brief The matches of for_each_block_match.
+ */
+inline std::vector<block_match> block_diff(const std::uint8_t* old_data, std::size_t old_size,
+                                           const std::uint8_t* new_data, std::size_t new_size,
+                                           const block_diff_options& options = {}) {
+    std::vector<block_match> matches;
+    for_each_block_match(old_data, old_size, new_data, new_size,
+                         [&](const block_match& m) { matches.push_back(m); }, options);
+    return matches;
+}
+
+enum class edit_kind {
+    keep,    // old bytes kept in place
+    move,    // old bytes reused out of order, or a second time
+    insert,  // new bytes found nowhere in the old buffer
+    remove   // old bytes not used by the new buffer
+};
+
+struct block_edit {
+    edit_kind kind;
+    std::size_t old_offset;
+    std::size_t new_offset;
+    std::size_t length;
+
+    friend bool operator==(const block_edit& x, const block_edit& y) noexcept {
+        return x.kind == y.kind && x.old_offset == y.old_offset &&
+               x.new_offset == y.new_offset && x.length == y.length;
+    }
+};
+
+/**
+ * \brief Calls f(block_edit) for the edits that turn the old buffer into
+ * the new one, given the matches of block_diff, in new buffer order.
+ *
+ * A match that continues forward in the old buffer is a keep, any other a
+ * move; the old bytes skipped by a keep and not used by any match are
+ * removed, and unmatched new bytes are inserted. An insert carries the old
+ * position it is made at and a remove the new one.
+ */
+template <typename F>
+void for_each_block_edit(const std::vector<block_match>& matches, std::size_t old_size,
+                         std::size_t new_size, F&& f) {
+    // The old bytes used by some match, as sorted disjoint ranges
+    std::vector<mismatch_range> used;
+    used.reserve(matches.size());
+    for (const block_match& m : matches) {
+        used.push_back({m.old_offset, m.length});
+    }
+    std::sort(used.begin(), used.end(),
+              [](const mismatch_range& x, const mismatch_range& y) { return x.offset < y.offset; });
+    std::size_t merged = 0;
+    for (const mismatch_range& r : used) {
+        if (merged != 0 && used[merged - 1].end() >= r.offset) {
+            used[merged - 1].length = std::max(used[merged - 1].end(), r.end()) -
+                                      used[merged - 1].offset;
+        } else {
+            used[merged++] = r;
+        }
+    }
+    used.resize(merged);
+
+    std::size_t cursor = 0;
+    std::size_t new_pos = 0;
+    std::size_t next_used = 0;
+    auto remove_until = [&](std::size_t end) {
+        for (std::size_t pos = cursor; pos < end;) {
+            while (next_used < used.size() && used[next_used].end() <= pos) {
+                ++next_used;
+            }
+            if (next_used < used.size() && used[next_used].offset <= pos) {
+                pos = std::min(used[next_used].end(), end);
+                continue;
+            }
+            std::size_t stop =
+                next_used < used.size() ? std::min(used[next_used].offset, end) : end;
+            f(block_edit{edit_kind::remove, pos, new_pos, stop - pos});
+            pos = stop;
+        }
+        cursor = std::max(cursor, end);
+    };
+
+    for (const block_match& m : matches) {
+        if (m.new_offset > new_pos) {
+            f(block_edit{edit_kind::insert, cursor, new_pos, m.new_offset - new_pos});
+        }
+        new_pos = m.new_offset;
+        if (m.old_offset >= cursor) {
+            remove_until(m.old_offset);
+            f(block_edit{edit_kind::keep, m.old_offset, m.new_offset, m.length});
+            cursor = m.old_end();
+        } else {
+            f(block_edit{edit_kind::move, m.old_offset, m.new_offset, m.length});
+        }
+        new_pos = m.new_end();
+    }
+    if (new_size > new_pos) {
+        f(block_edit{edit_kind::insert, cursor, new_pos, new_size - new_pos});
+    }
+    new_pos = new_size;
+    remove_until(old_size);
+}
+
+#endif // BLOCK_DIFF_H
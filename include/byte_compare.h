@@ -0,0 +1,493 @@
+#ifndef BYTE_COMPARE_H
+#define BYTE_COMPARE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "check_env.h"
+#include "thread_pool.h"
+
+#if CHECK_ENV_X86
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/*
+ * Finding the bytes at which two buffers differ.
+ *
+ * The buffers are scanned in 64-byte blocks. Equal blocks cost a few vector
+ * compares and one branch, so long equal stretches are skipped at close to
+ * memory bandwidth; only a block that differs is turned into a 64-bit mask
+ * with one bit per differing byte, whose set bits are then visited with
+ * count-trailing-zeros. The vector kernels (SSE2, AVX2, AVX-512BW) are
+ * selected at startup through check_env; other targets compare 8 bytes at a
+ * time.
+ */
+
+/**
+ * \brief The index of the lowest set bit of a non-zero x.
+ */
+inline int ctz64(std::uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int index = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+inline int popcount64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    int count = 0;
+    for (; x != 0; x &= x - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * \brief Bit i set for every i in [0, n) with a[i] != b[i]; n is at most 64.
+ */
+inline std::uint64_t mismatch_mask_scalar(const std::uint8_t* a, const std::uint8_t* b,
+                                          std::size_t n) noexcept {
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        mask |= std::uint64_t(a[i] != b[i]) << i;
+    }
+    return mask;
+}
+
+/*
+ * A mismatch block kernel scans a and b (n bytes each) for the first 64-byte
+ * block, counted from a, that contains a difference. It returns the offset
+ * of that block and stores its mismatch_mask in *mask, or returns n and
+ * stores 0 if the buffers are equal. The last block may be shorter than 64
+ * bytes; mask bits past n are always clear.
+ */
+using mismatch_block_fn = std::size_t(const std::uint8_t*, const std::uint8_t*, std::size_t,
+                                      std::uint64_t*);
+
+inline std::size_t mismatch_tail(const std::uint8_t* a, const std::uint8_t* b, std::size_t i,
+                                 std::size_t n, std::uint64_t* mask) noexcept {
+    *mask = i < n ? mismatch_mask_scalar(a + i, b + i, n - i) : 0;
+    return *mask != 0 ? i : n;
+}
+
+inline std::size_t mismatch_block_scalar(const std::uint8_t* a, const std::uint8_t* b,
+                                         std::size_t n, std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        std::uint64_t diff = 0;
+        for (std::size_t w = 0; w < 64; w += 8) {
+            diff |= check_env::load_unaligned<std::uint64_t>(a + i + w) ^
+                    check_env::load_unaligned<std::uint64_t>(b + i + w);
+        }
+        if (diff != 0) {
+            *mask = mismatch_mask_scalar(a + i, b + i, 64);
+            return i;
+        }
+    }
+    return mismatch_tail(a, b, i, n, mask);
+}
+
+#if CHECK_ENV_X86
+CHECK_ENV_TARGET("sse2")
+inline std::size_t mismatch_block_sse2(const std::uint8_t* a, const std::uint8_t* b,
+                                       std::size_t n, std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m128i eq[4];
+        for (int k = 0; k < 4; ++k) {
+            eq[k] = _mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 16 * k)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 16 * k)));
+        }
+        __m128i all = _mm_and_si128(_mm_and_si128(eq[0], eq[1]), _mm_and_si128(eq[2], eq[3]));
+        if (_mm_movemask_epi8(all) != 0xffff) {
+            std::uint64_t equal = 0;
+            for (int k = 0; k < 4; ++k) {
+                equal |= std::uint64_t(static_cast<unsigned>(_mm_movemask_epi8(eq[k])))
+                         << (16 * k);
+            }
+            *mask = ~equal;
+            return i;
+        }
+    }
+    return mismatch_tail(a, b, i, n, mask);
+}
+
+CHECK_ENV_TARGET("avx2")
+inline std::size_t mismatch_block_avx2(const std::uint8_t* a, const std::uint8_t* b,
+                                       std::size_t n, std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m256i eq0 =
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        __m256i eq1 =
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32)),
+                              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32)));
+        if (!_mm256_testc_si256(_mm256_and_si256(eq0, eq1), _mm256_set1_epi8(-1))) {
+            std::uint64_t equal =
+                std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(eq0))) |
+                std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(eq1))) << 32;
+            *mask = ~equal;
+            return i;
+        }
+    }
+    return mismatch_tail(a, b, i, n, mask);
+}
+
+// AVX-512BW compares straight into a 64-bit mask, and masked loads cover
+// the tail without reading past it
+CHECK_ENV_TARGET("avx512f,avx512bw")
+inline std::size_t mismatch_block_avx512(const std::uint8_t* a, const std::uint8_t* b,
+                                         std::size_t n, std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __mmask64 diff =
+            _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+        if (diff != 0) {
+            *mask = diff;
+            return i;
+        }
+    }
+    if (i < n) {
+        __mmask64 tail = (std::uint64_t(1) << (n - i)) - 1;
+        __mmask64 diff = _mm512_mask_cmpneq_epi8_mask(tail, _mm512_maskz_loadu_epi8(tail, a + i),
+                                                      _mm512_maskz_loadu_epi8(tail, b + i));
+        if (diff != 0) {
+            *mask = diff;
+            return i;
+        }
+    }
+    *mask = 0;
+    return n;
+}
+#endif
+
+/**
+ * \brief The mismatch block kernels for each check_env tier.
+ */
+inline check_env::kernel_set<mismatch_block_fn> mismatch_block_kernels() {
+#if CHECK_ENV_X86 && (defined(__SSE2__) || defined(_M_X64))
+    return {&mismatch_block_sse2, &mismatch_block_sse2, &mismatch_block_avx2,
+            &mismatch_block_avx512};
+#elif CHECK_ENV_X86
+    return {&mismatch_block_scalar, &mismatch_block_sse2, &mismatch_block_avx2,
+            &mismatch_block_avx512};
+#else
+    return {&mismatch_block_scalar};
+#endif
+}
+
+/**
+ * \brief The best mismatch block kernel for the running CPU.
+ */
+inline std::size_t find_mismatch_block(const std::uint8_t* a, const std::uint8_t* b,
+                                       std::size_t n, std::uint64_t* mask) {
+    static const check_env::kernel<mismatch_block_fn> kernel(mismatch_block_kernels());
+    return kernel(a, b, n, mask);
+}
+
+/**
+ * \brief The first i in [0, n) with a[i] != b[i], or n if there is none.
+ */
+inline std::size_t find_mismatch(const std::uint8_t* a, const std::uint8_t* b, std::size_t n) {
+    std::uint64_t mask;
+    std::size_t block = find_mismatch_block(a, b, n, &mask);
+    return block == n ? n : block + static_cast<std::size_t>(ctz64(mask));
+}
+
+/**
+ * \brief Calls f(i) for every i in [0, n) with a[i] != b[i], in ascending order.
+ */
+template <typename F>
+void for_each_mismatch(const std::uint8_t* a, const std::uint8_t* b, std::size_t n, F&& f) {
+    std::size_t i = 0;
+    while (i < n) {
+        std::uint64_t mask;
+        std::size_t block = i + find_mismatch_block(a + i, b + i, n - i, &mask);
+        if (block >= n) {
+            break;
+        }
+        for (; mask != 0; mask &= mask - 1) {
+            f(block + static_cast<std::size_t>(ctz64(mask)));
+        }
+        i = block + 64;
+    }
+}
+
+/**
+ * \brief The number of i in [0, n) with a[i] != b[i].
+ */
+inline std::size_t count_mismatches(const std::uint8_t* a, const std::uint8_t* b,
+                                    std::size_t n) {
+    std::size_t count = 0;
+    std::size_t i = 0;
+    while (i < n) {
+        std::uint64_t mask;
+        std::size_t block = i + find_mismatch_block(a + i, b + i, n - i, &mask);
+        if (block >= n) {
+            break;
+        }
+        count += static_cast<std::size_t>(popcount64(mask));
+        i = block + 64;
+    }
+    return count;
+}
+
+/**
+ * \brief A maximal run of differing bytes.
+ */
+struct mismatch_range {
+    std::size_t offset;
+    std::size_t length;
+
+    std::size_t end() const noexcept { return offset + length; }
+
+    friend bool operator==(const mismatch_range& x, const mismatch_range& y) noexcept {
+        return x.offset == y.offset && x.length == y.length;
+    }
+};
+
+/**
+ * \brief Extends run with the runs of the mismatch mask of the block at
+ * offset block, calling f(run) for each run that is complete.
+ */
+template <typename F>
+void add_block_runs(std::size_t block, std::uint64_t mask, mismatch_range& run, F& f) {
+    while (mask != 0) {
+        int start = ctz64(mask);
+        std::uint64_t rest = ~(mask >> start);
+        int length = rest == 0 ? 64 - start : ctz64(rest);
+        if (run.length != 0 && run.end() == block + static_cast<std::size_t>(start)) {
+            run.length += static_cast<std::size_t>(length);
+        } else {
+            if (run.length != 0) {
+                f(run);
+            }
+            run = {block + static_cast<std::size_t>(start), static_cast<std::size_t>(length)};
+        }
+        mask = start + length >= 64 ? 0 : mask & (~std::uint64_t(0) << (start + length));
+    }
+}
+
+/**
+ * \brief Calls f(mismatch_range) for every maximal run of differing bytes in
+ * [0, n), in ascending order.
+ *
+ * Runs are read from the block masks with ctz, so a fully differing block
+ * costs the same as a block with one difference, and runs spanning several
+ * blocks are reported once. Nothing is allocated.
+ */
+template <typename F>
+void for_each_mismatch_range(const std::uint8_t* a, const std::uint8_t* b, std::size_t n,
+                             F&& f) {
+    mismatch_range run{0, 0};
+    std::size_t i = 0;
+    while (i < n) {
+        std::uint64_t mask;
+        std::size_t block = i + find_mismatch_block(a + i, b + i, n - i, &mask);
+        if (block >= n) {
+            break;
+        }
+        add_block_runs(block, mask, run, f);
+        i = block + 64;
+    }
+    if (run.length != 0) {
+        f(run);
+    }
+}
+
+/*
+ * Parallel scans split the buffers into chunks of compare_chunk_size()
+ * bytes and hand them to a thread_pool in ascending order. A single core
+ * cannot saturate the memory bandwidth of a large machine; chunks much
+ * larger than a page keep the per-chunk overhead negligible, and being
+ * page multiples they never split a page between two threads. Inputs of
+ * one chunk or less are scanned on the calling thread.
+ */
+
+/**
+ * \brief Bytes per chunk of a parallel scan: half the L2 cache in whole
+ * pages, at least 64 KiB.
+ */
+inline std::size_t compare_chunk_size() {
+    const check_env::system_topology& t = check_env::topology();
+    std::size_t chunk = t.l2_cache_size / 2 / t.page_size * t.page_size;
+    return std::max<std::size_t>(chunk, 64 * 1024);
+}
+
+/**
+ * \brief find_mismatch, scanning chunks in parallel.
+ *
+ * Once a mismatch is found, chunks after it are no longer scanned; only the
+ * chunks before it still run to completion.
+ */
+inline std::size_t parallel_find_mismatch(const std::uint8_t* a, const std::uint8_t* b,
+                                          std::size_t n,
+                                          thread_pool& pool = thread_pool::shared()) {
+    std::size_t chunk = compare_chunk_size();
+    if (n <= chunk || pool.size() == 1) {
+        return find_mismatch(a, b, n);
+    }
+    std::atomic<std::size_t> first{n};
+    pool.parallel_for((n + chunk - 1) / chunk, [&](std::size_t c) {
+        std::size_t begin = c * chunk;
+        if (begin >= first.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::size_t length = std::min(chunk, n - begin);
+        std::size_t found = find_mismatch(a + begin, b + begin, length);
+        if (found == length) {
+            return;
+        }
+        std::size_t position = begin + found;
+        std::size_t current = first.load(std::memory_order_relaxed);
+        while (position < current &&
+               !first.compare_exchange_weak(current, position, std::memory_order_relaxed)) {
+        }
+    });
+    return first.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief count_mismatches, scanning chunks in parallel.
+ */
+inline std::size_t parallel_count_mismatches(const std::uint8_t* a, const std::uint8_t* b,
+                                             std::size_t n,
+                                             thread_pool& pool = thread_pool::shared()) {
+    std::size_t chunk = compare_chunk_size();
+    if (n <= chunk || pool.size() == 1) {
+        return count_mismatches(a, b, n);
+    }
+    std::atomic<std::size_t> count{0};
+    pool.parallel_for((n + chunk - 1) / chunk, [&](std::size_t c) {
+        std::size_t begin = c * chunk;
+        count.fetch_add(count_mismatches(a + begin, b + begin, std::min(chunk, n - begin)),
+                        std::memory_order_relaxed);
+    });
+    return count.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Most runs one chunk of parallel_for_each_mismatch_range buffers
+ * before it leaves the rest of the chunk to the calling thread.
+ */
+constexpr std::size_t parallel_run_limit = 1024;
+
+/**
+ * \brief Appends the maximal runs of differing bytes in [0, n) to runs, in
+ * ascending order, until runs holds run_limit of them. Returns where the
+ * scan stopped: n, or the end of the 64-byte block that reached the limit,
+ * so runs ends up with at most run_limit + 31 entries. A run cut there may
+ * continue after the returned offset.
+ */
+inline std::size_t collect_mismatch_ranges(const std::uint8_t* a, const std::uint8_t* b,
+                                           std::size_t n, std::vector<mismatch_range>& runs,
+                                           std::size_t run_limit = parallel_run_limit) {
+    auto push = [&runs](const mismatch_range& r) { runs.push_back(r); };
+    mismatch_range run{0, 0};
+    std::size_t i = 0;
+    while (i < n) {
+        std::uint64_t mask;
+        std::size_t block = i + find_mismatch_block(a + i, b + i, n - i, &mask);
+        if (block >= n) {
+            i = n;
+            break;
+        }
+        add_block_runs(block, mask, run, push);
+        i = std::min(block + 64, n);
+        if (runs.size() + 1 >= run_limit) {
+            break;
+        }
+    }
+    if (run.length != 0) {
+        runs.push_back(run);
+    }
+    return i;
+}
+
+/**
+ * \brief for_each_mismatch_range, scanning chunks in parallel.
+ *
+ * The chunks are processed in rounds of a few per thread. Each round
+ * collects the runs of every chunk, then passes them to f in order on the
+ * calling thread, joining runs that cross a chunk boundary. A chunk buffers
+ * at most about parallel_run_limit runs; where it has more, e.g. when every
+ * other byte differs, the rest of it is scanned on the calling thread while
+ * merging. Memory use is therefore bounded by the pool size, not by the
+ * number of runs.
+ */
+template <typename F>
+void parallel_for_each_mismatch_range(const std::uint8_t* a, const std::uint8_t* b,
+                                      std::size_t n, F&& f,
+                                      thread_pool& pool = thread_pool::shared()) {
+    std::size_t chunk = compare_chunk_size();
+    if (n <= chunk || pool.size() == 1) {
+        for_each_mismatch_range(a, b, n, f);
+        return;
+    }
+    std::size_t chunk_count = (n + chunk - 1) / chunk;
+    std::size_t round = std::size_t(pool.size()) * 4;
+    std::vector<std::vector<mismatch_range>> runs(std::min(round, chunk_count));
+    std::vector<std::size_t> stops(runs.size());
+
+    mismatch_range pending{0, 0};
+    auto emit = [&](const mismatch_range& r) {
+        if (pending.length != 0 && pending.end() == r.offset) {
+            pending.length += r.length;
+        } else {
+            if (pending.length != 0) {
+                f(pending);
+            }
+            pending = r;
+        }
+    };
+    for (std::size_t first = 0; first < chunk_count; first += round) {
+        std::size_t count = std::min(round, chunk_count - first);
+        pool.parallel_for(count, [&](std::size_t k) {
+            std::size_t begin = (first + k) * chunk;
+            runs[k].clear();
+            stops[k] = collect_mismatch_ranges(a + begin, b + begin, std::min(chunk, n - begin),
+                                               runs[k]);
+        });
+        for (std::size_t k = 0; k < count; ++k) {
+            std::size_t begin = (first + k) * chunk;
+            for (const mismatch_range& r : runs[k]) {
+                emit({begin + r.offset, r.length});
+            }
+            std::size_t length = std::min(chunk, n - begin);
+            if (stops[k] < length) {
+                std::size_t rest = begin + stops[k];
+                for_each_mismatch_range(a + rest, b + rest, length - stops[k],
+                                        [&](mismatch_range r) {
+                                            emit({rest + r.offset, r.length});
+                                        });
+            }
+        }
+    }
+    if (pending.length != 0) {
+        f(pending);
+    }
+}
+
+#endif // BYTE_COMPARE_H
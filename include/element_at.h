@@ -1,6 +1,7 @@
 #ifndef ELEMENT_AT_H
 #define ELEMENT_AT_H
 
+#include <cstddef>
 #include <type_traits>
 
 // Define a type list using variadic templates
@@ -9,19 +10,25 @@ struct TypeList {};
 
 // Define a pair of index and type
 template <std::size_t Index, typename T>
-struct IndexedType {};
+struct IndexedType {
+    using type = T;
+};
 
 // Primary template for element_at
 template <std::size_t Index, typename List>
 struct element_at;
 
-// Specialization for TypeList
+// Specialization for TypeList: the IndexedType base of `all` that matches
+// Index is found by template argument deduction. For lists indexed by
+// position, tmpl_lib::at in type_list.h scales to much longer lists.
 template <std::size_t Index, typename... Ts>
 struct element_at<Index, TypeList<Ts...>> {
-    template <std::size_t I, typename T>
-    static constexpr T helper(IndexedType<I, T>);
+    struct all : Ts... {};
+
+    template <typename T>
+    static IndexedType<Index, T> helper(const IndexedType<Index, T>*);
 
-    using type = decltype(helper<Index>(std::declval<Ts>()...));
+    using type = typename decltype(helper(static_cast<const all*>(nullptr)))::type;
 };
 
 // Helper alias template
@@ -0,0 +1,157 @@
+#ifndef FIELD_DIFF_H
+#define FIELD_DIFF_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bit_layout.h"
+#include "byte_compare.h"
+#include "packed_record.h"
+#include "seq.h"
+
+/*
+ * Differences between two arrays of packed records, reported per field.
+ *
+ * The record layout is given as split_total_seq_helper<W, Bits...> or as a
+ * packed_record (including PACKED_RECORD types): records of W-bit words
+ * holding fields of the given widths, field 0 in the least significant bits
+ * of the first word. Equal stretches are skipped with the vector mismatch
+ * kernels of byte_compare.h, which XOR and test 64 bytes at a time. In a
+ * record that differs, the XOR of each word pair is walked with ctz and only
+ * the fields holding a set bit are extracted.
+ */
+
+/**
+ * \brief One field that differs between two records.
+ */
+struct field_difference {
+    std::size_t record;
+    std::size_t field;
+    std::uint64_t old_value;
+    std::uint64_t new_value;
+    // old_value ^ new_value: the bits of the field that changed
+    std::uint64_t changed_bits;
+
+    friend bool operator==(const field_difference& x, const field_difference& y) noexcept {
+        return x.record == y.record && x.field == y.field && x.old_value == y.old_value &&
+               x.new_value == y.new_value && x.changed_bits == y.changed_bits;
+    }
+};
+
+template <int W, int... Bits>
+packed_record<W, Bits...> record_layout_of(const split_total_seq_helper<W, Bits...>*);
+
+template <int W, int... Bits>
+packed_record<W, Bits...> record_layout_of(const packed_record<W, Bits...>*);
+
+/**
+ * \brief The packed_record type of a layout given as split_total_seq_helper
+ * or packed_record.
+ */
+template <typename Layout>
+using record_layout_t = decltype(record_layout_of(static_cast<const Layout*>(nullptr)));
+
+// The bit offset of each field
+template <int... Bits>
+constexpr std::array<int, sizeof...(Bits)> field_offsets() noexcept {
+    constexpr int widths[] = {Bits...};
+    std::array<int, sizeof...(Bits)> offsets{};
+    int offset = 0;
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        offsets[i] = offset;
+        offset += widths[i];
+    }
+    return offsets;
+}
+
+// The field holding each bit of the record
+template <int... Bits>
+constexpr std::array<std::uint16_t, (Bits + ...)> field_at_bit() noexcept {
+    constexpr int widths[] = {Bits...};
+    std::array<std::uint16_t, (Bits + ...)> fields{};
+    std::size_t bit = 0;
+    for (std::size_t i = 0; i < sizeof...(Bits); ++i) {
+        for (int j = 0; j < widths[i]; ++j) {
+            fields[bit++] = static_cast<std::uint16_t>(i);
+        }
+    }
+    return fields;
+}
+
+/**
+ * \brief Per-field tables of a packed_record layout.
+ */
+template <typename Record>
+struct field_table;
+
+template <int W, int... Bits>
+struct field_table<packed_record<W, Bits...>> {
+    static constexpr std::size_t record_bytes =
+        sizeof(typename packed_record<W, Bits...>::word_type) * (Bits + ...) / W;
+    static constexpr std::array<int, sizeof...(Bits)> widths = {Bits...};
+    static constexpr std::array<int, sizeof...(Bits)> offsets = field_offsets<Bits...>();
+    static constexpr std::array<std::uint16_t, (Bits + ...)> field_at_bit =
+        ::field_at_bit<Bits...>();
+};
+
+/**
+ * \brief Calls f(field_difference) for every field that differs between
+ * old_records[i] and new_records[i], i in [0, count), ordered by record and
+ * then by field. The records may be stored at any byte offset.
+ */
+template <typename Layout, typename F>
+void for_each_field_difference(const void* old_records, const void* new_records,
+                               std::size_t count, F&& f) {
+    using record = record_layout_t<Layout>;
+    using table = field_table<record>;
+    using word_type = typename record::word_type;
+    constexpr int W = static_cast<int>(sizeof(word_type) * 8);
+    static_assert(record::field_count <= 0x10000, "Too many fields");
+
+    const auto* a = static_cast<const std::uint8_t*>(old_records);
+    const auto* b = static_cast<const std::uint8_t*>(new_records);
+    std::size_t bytes = count * table::record_bytes;
+    std::size_t i = 0;
+    while (i < bytes) {
+        std::uint64_t mask;
+        std::size_t block = i + find_mismatch_block(a + i, b + i, bytes - i, &mask);
+        if (block >= bytes) {
+            break;
+        }
+        std::size_t index = (block + static_cast<std::size_t>(ctz64(mask))) / table::record_bytes;
+        record x;
+        record y;
+        x.load(a + index * table::record_bytes);
+        y.load(b + index * table::record_bytes);
+        for (std::size_t w = 0; w < record::word_count; ++w) {
+            std::uint64_t changed = std::uint64_t(x.words[w] ^ y.words[w]);
+            while (changed != 0) {
+                std::size_t field = table::field_at_bit[w * W + ctz64(changed)];
+                int shift = table::offsets[field] % W;
+                std::uint64_t field_mask = low_bits_mask(table::widths[field]);
+                f(field_difference{index, field, (std::uint64_t(x.words[w]) >> shift) & field_mask,
+                                   (std::uint64_t(y.words[w]) >> shift) & field_mask,
+                                   (changed >> shift) & field_mask});
+                changed &= ~(field_mask << shift);
+            }
+        }
+        i = (index + 1) * table::record_bytes;
+    }
+}
+
+/**
+ * \brief All field differences between two record arrays; see
+ * for_each_field_difference.
+ */
+template <typename Layout>
+std::vector<field_difference> compare_fields(const void* old_records, const void* new_records,
+                                             std::size_t count) {
+    std::vector<field_difference> differences;
+    for_each_field_difference<Layout>(old_records, new_records, count,
+                                      [&](const field_difference& d) { differences.push_back(d); });
+    return differences;
+}
+
+#endif // FIELD_DIFF_H
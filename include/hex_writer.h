@@ -0,0 +1,109 @@
+#ifndef HEX_WRITER_H
+#define HEX_WRITER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+
+// Collects rendered text in a reusable buffer and writes it to the stream
+// one large block at a time; hex digits come from a lookup table instead of
+// stream manipulators
+class HexWriter {
+public:
+    static constexpr std::size_t capacity = 64 * 1024;
+
+    explicit HexWriter(std::ostream& out) : out_(out), buffer_(new char[capacity]) {}
+
+    HexWriter(const HexWriter&) = delete;
+    HexWriter& operator=(const HexWriter&) = delete;
+
+    ~HexWriter() { flush(); }
+
+    HexWriter& append(const char* text, std::size_t length) {
+        if (size_ + length > capacity) {
+            flush();
+            if (length > capacity) {
+                out_.write(text, static_cast<std::streamsize>(length));
+                return *this;
+            }
+        }
+        std::memcpy(buffer_.get() + size_, text, length);
+        size_ += length;
+        return *this;
+    }
+
+    HexWriter& operator<<(const std::string& text) { return append(text.data(), text.size()); }
+    HexWriter& operator<<(const char* text) { return append(text, std::strlen(text)); }
+
+    HexWriter& repeat(char c, std::size_t count) {
+        while (count > 0) {
+            if (size_ == capacity) {
+                flush();
+            }
+            std::size_t n = std::min(count, capacity - size_);
+            std::memset(buffer_.get() + size_, c, n);
+            size_ += n;
+            count -= n;
+        }
+        return *this;
+    }
+
+    // Two lowercase hex digits
+    HexWriter& hex_byte(uint8_t value) { return append(hex_pairs() + 2 * value, 2); }
+
+    // Lowercase hex, zero-padded to at least min_digits digits
+    HexWriter& hex(std::size_t value, int min_digits) {
+        char digits[2 * sizeof(std::size_t)];
+        int count = 0;
+        do {
+            digits[sizeof(digits) - 1 - count++] = "0123456789abcdef"[value & 15];
+            value >>= 4;
+        } while (value != 0);
+        if (count < min_digits) {
+            repeat('0', static_cast<std::size_t>(min_digits - count));
+        }
+        return append(digits + sizeof(digits) - count, static_cast<std::size_t>(count));
+    }
+
+    HexWriter& dec(std::size_t value) {
+        char digits[24];
+        int count = 0;
+        do {
+            digits[sizeof(digits) - 1 - count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        return append(digits + sizeof(digits) - count, static_cast<std::size_t>(count));
+    }
+
+    void flush() {
+        if (size_ != 0) {
+            out_.write(buffer_.get(), static_cast<std::streamsize>(size_));
+            size_ = 0;
+        }
+    }
+
+private:
+    // "000102...feff"
+    static const char* hex_pairs() {
+        static const struct table {
+            char text[512];
+            table() : text() {
+                for (int i = 0; i < 256; ++i) {
+                    text[2 * i] = "0123456789abcdef"[i >> 4];
+                    text[2 * i + 1] = "0123456789abcdef"[i & 15];
+                }
+            }
+        } pairs;
+        return pairs.text;
+    }
+
+    std::ostream& out_;
+    std::unique_ptr<char[]> buffer_;
+    std::size_t size_ = 0;
+};
+
+#endif // HEX_WRITER_H
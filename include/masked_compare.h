@@ -0,0 +1,325 @@
+#ifndef MASKED_COMPARE_H
+#define MASKED_COMPARE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "byte_compare.h"
+#include "check_env.h"
+
+/*
+ * Comparing buffers while ignoring don't-care bits.
+ *
+ * A mask selects the bits that count: byte i differs when
+ * (a[i] ^ b[i]) & mask[i] is non-zero. The mask is given per byte, as one
+ * record-shaped mask repeated over the buffers, or as a list of ignored
+ * byte ranges. The kernels AND the XOR of each 64-byte block with the mask
+ * and test the result, so the buffers are read once and never copied; an
+ * ignored range is not read at all.
+ */
+
+/**
+ * \brief Bit i set for every i in [0, n) with (a[i] ^ b[i]) & m[i] non-zero;
+ * n is at most 64.
+ */
+inline std::uint64_t masked_mismatch_mask_scalar(const std::uint8_t* a, const std::uint8_t* b,
+                                                 const std::uint8_t* m, std::size_t n) noexcept {
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        mask |= std::uint64_t(((a[i] ^ b[i]) & m[i]) != 0) << i;
+    }
+    return mask;
+}
+
+/*
+ * A masked mismatch block kernel works like a mismatch block kernel, with
+ * the per-byte mask m (n bytes) applied to every comparison.
+ */
+using masked_mismatch_block_fn = std::size_t(const std::uint8_t*, const std::uint8_t*,
+                                             const std::uint8_t*, std::size_t, std::uint64_t*);
+
+inline std::size_t masked_mismatch_tail(const std::uint8_t* a, const std::uint8_t* b,
+                                        const std::uint8_t* m, std::size_t i, std::size_t n,
+                                        std::uint64_t* mask) noexcept {
+    *mask = i < n ? masked_mismatch_mask_scalar(a + i, b + i, m + i, n - i) : 0;
+    return *mask != 0 ? i : n;
+}
+
+inline std::size_t masked_mismatch_block_scalar(const std::uint8_t* a, const std::uint8_t* b,
+                                                const std::uint8_t* m, std::size_t n,
+                                                std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        std::uint64_t diff = 0;
+        for (std::size_t w = 0; w < 64; w += 8) {
+            diff |= (check_env::load_unaligned<std::uint64_t>(a + i + w) ^
+                     check_env::load_unaligned<std::uint64_t>(b + i + w)) &
+                    check_env::load_unaligned<std::uint64_t>(m + i + w);
+        }
+        if (diff != 0) {
+            *mask = masked_mismatch_mask_scalar(a + i, b + i, m + i, 64);
+            return i;
+        }
+    }
+    return masked_mismatch_tail(a, b, m, i, n, mask);
+}
+
+#if CHECK_ENV_X86
+CHECK_ENV_TARGET("sse2")
+inline std::size_t masked_mismatch_block_sse2(const std::uint8_t* a, const std::uint8_t* b,
+                                              const std::uint8_t* m, std::size_t n,
+                                              std::uint64_t* mask) {
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m128i diff[4];
+        for (int k = 0; k < 4; ++k) {
+            diff[k] = _mm_and_si128(
+                _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 16 * k)),
+                              _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 16 * k))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(m + i + 16 * k)));
+        }
+        __m128i any = _mm_or_si128(_mm_or_si128(diff[0], diff[1]), _mm_or_si128(diff[2], diff[3]));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xffff) {
+            std::uint64_t equal = 0;
+            for (int k = 0; k < 4; ++k) {
+                equal |= std::uint64_t(static_cast<unsigned>(
+                             _mm_movemask_epi8(_mm_cmpeq_epi8(diff[k], zero))))
+                         << (16 * k);
+            }
+            *mask = ~equal;
+            return i;
+        }
+    }
+    return masked_mismatch_tail(a, b, m, i, n, mask);
+}
+
+CHECK_ENV_TARGET("avx2")
+inline std::size_t masked_mismatch_block_avx2(const std::uint8_t* a, const std::uint8_t* b,
+                                              const std::uint8_t* m, std::size_t n,
+                                              std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        __m256i x1 =
+            _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32)),
+                             _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32)));
+        __m256i m0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i));
+        __m256i m1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i + 32));
+        // vptest ANDs with the mask itself, so the clean path is one test per half
+        if (!_mm256_testz_si256(x0, m0) || !_mm256_testz_si256(x1, m1)) {
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i eq0 = _mm256_cmpeq_epi8(_mm256_and_si256(x0, m0), zero);
+            __m256i eq1 = _mm256_cmpeq_epi8(_mm256_and_si256(x1, m1), zero);
+            std::uint64_t equal =
+                std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(eq0))) |
+                std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(eq1))) << 32;
+            *mask = ~equal;
+            return i;
+        }
+    }
+    return masked_mismatch_tail(a, b, m, i, n, mask);
+}
+
+// vptestmb gives the bytes where (a ^ b) & m is non-zero as a 64-bit mask
+CHECK_ENV_TARGET("avx512f,avx512bw")
+inline std::size_t masked_mismatch_block_avx512(const std::uint8_t* a, const std::uint8_t* b,
+                                                const std::uint8_t* m, std::size_t n,
+                                                std::uint64_t* mask) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __mmask64 diff = _mm512_test_epi8_mask(
+            _mm512_xor_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)),
+            _mm512_loadu_si512(m + i));
+        if (diff != 0) {
+            *mask = diff;
+            return i;
+        }
+    }
+    if (i < n) {
+        __mmask64 tail = (std::uint64_t(1) << (n - i)) - 1;
+        __mmask64 diff = _mm512_test_epi8_mask(
+            _mm512_xor_si512(_mm512_maskz_loadu_epi8(tail, a + i),
+                             _mm512_maskz_loadu_epi8(tail, b + i)),
+            _mm512_maskz_loadu_epi8(tail, m + i));
+        if (diff != 0) {
+            *mask = diff;
+            return i;
+        }
+    }
+    *mask = 0;
+    return n;
+}
+#endif
+
+/**
+ * \brief The masked mismatch block kernels for each check_env tier.
+ */
+inline check_env::kernel_set<masked_mismatch_block_fn> masked_mismatch_block_kernels() {
+#if CHECK_ENV_X86 && (defined(__SSE2__) || defined(_M_X64))
+    return {&masked_mismatch_block_sse2, &masked_mismatch_block_sse2,
+            &masked_mismatch_block_avx2, &masked_mismatch_block_avx512};
+#elif CHECK_ENV_X86
+    return {&masked_mismatch_block_scalar, &masked_mismatch_block_sse2,
+            &masked_mismatch_block_avx2, &masked_mismatch_block_avx512};
+#else
+    return {&masked_mismatch_block_scalar};
+#endif
+}
+
+/**
+ * \brief The best masked mismatch block kernel for the running CPU.
+ */
+inline std::size_t find_masked_mismatch_block(const std::uint8_t* a, const std::uint8_t* b,
+                                              const std::uint8_t* m, std::size_t n,
+                                              std::uint64_t* mask) {
+    static const check_env::kernel<masked_mismatch_block_fn> kernel(
+        masked_mismatch_block_kernels());
+    return kernel(a, b, m, n, mask);
+}
+
+/**
+ * \brief A mask of one record, applied to every record of the buffers.
+ *
+ * phase is the position of the first buffer byte within a record, for
+ * buffers that do not start on a record boundary.
+ */
+struct repeating_mask {
+    const std::uint8_t* bytes;
+    std::size_t size;
+    std::size_t phase = 0;
+};
+
+/**
+ * \brief Calls f(mismatch_range) for every maximal run of bytes in [0, n)
+ * that differ in a bit selected by the per-byte mask m, in ascending order.
+ */
+template <typename F>
+void for_each_masked_mismatch_range(const std::uint8_t* a, const std::uint8_t* b, std::size_t n,
+                                    const std::uint8_t* m, F&& f) {
+    mismatch_range run{0, 0};
+    std::size_t i = 0;
+    while (i < n) {
+        std::uint64_t mask;
+        std::size_t block = i + find_masked_mismatch_block(a + i, b + i, m + i, n - i, &mask);
+        if (block >= n) {
+            break;
+        }
+        add_block_runs(block, mask, run, f);
+        i = block + 64;
+    }
+    if (run.length != 0) {
+        f(run);
+    }
+}
+
+/**
+ * \brief for_each_masked_mismatch_range with a record mask repeated over
+ * the buffers.
+ *
+ * The record mask is laid out a few times over in a tile of at least 8 KiB
+ * that stays in the L1 cache, and the buffers are scanned tile by tile.
+ */
+template <typename F>
+void for_each_masked_mismatch_range(const std::uint8_t* a, const std::uint8_t* b, std::size_t n,
+                                    const repeating_mask& m, F&& f) {
+    if (n == 0 || m.size == 0) {
+        return;
+    }
+    std::size_t records = std::max<std::size_t>(1, (std::size_t(8) << 10) / m.size);
+    std::vector<std::uint8_t> tile(std::min(records * m.size, n));
+    for (std::size_t j = 0; j < tile.size(); ++j) {
+        tile[j] = m.bytes[(m.phase + j) % m.size];
+    }
+
+    mismatch_range run{0, 0};
+    for (std::size_t begin = 0; begin < n; begin += tile.size()) {
+        std::size_t length = std::min(tile.size(), n - begin);
+        for (std::size_t i = 0; i < length;) {
+            std::uint64_t mask;
+            std::size_t block =
+                i + find_masked_mismatch_block(a + begin + i, b + begin + i, tile.data() + i,
+                                               length - i, &mask);
+            if (block >= length) {
+                break;
+            }
+            add_block_runs(begin + block, mask, run, f);
+            i = block + 64;
+        }
+    }
+    if (run.length != 0) {
+        f(run);
+    }
+}
+
+/**
+ * \brief for_each_mismatch_range outside the ignored byte ranges, which may
+ * be given in any order and may overlap.
+ */
+template <typename F>
+void for_each_masked_mismatch_range(const std::uint8_t* a, const std::uint8_t* b, std::size_t n,
+                                    const std::vector<mismatch_range>& ignored, F&& f) {
+    std::vector<mismatch_range> sorted(ignored);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const mismatch_range& x, const mismatch_range& y) { return x.offset < y.offset; });
+
+    mismatch_range run{0, 0};
+    auto join = [&](mismatch_range r) {
+        if (run.length != 0 && run.end() == r.offset) {
+            run.length += r.length;
+            return;
+        }
+        if (run.length != 0) {
+            f(run);
+        }
+        run = r;
+    };
+    std::size_t begin = 0;
+    auto compare_until = [&](std::size_t end) {
+        if (end > begin) {
+            for_each_mismatch_range(a + begin, b + begin, end - begin, [&](mismatch_range r) {
+                join({begin + r.offset, r.length});
+            });
+        }
+    };
+    for (const mismatch_range& skip : sorted) {
+        if (skip.offset >= n) {
+            break;
+        }
+        compare_until(skip.offset);
+        begin = std::max(begin, std::min(skip.end(), n));
+    }
+    compare_until(n);
+    if (run.length != 0) {
+        f(run);
+    }
+}
+
+/**
+ * \brief The runs of bytes that differ under mask: a per-byte mask buffer
+ * of n bytes, a repeating_mask, or a list of ignored ranges.
+ */
+template <typename Mask>
+std::vector<mismatch_range> compare_masked(const std::uint8_t* a, const std::uint8_t* b,
+                                           std::size_t n, const Mask& mask) {
+    std::vector<mismatch_range> ranges;
+    for_each_masked_mismatch_range(a, b, n, mask,
+                                   [&](mismatch_range r) { ranges.push_back(r); });
+    return ranges;
+}
+
+/**
+ * \brief The number of bytes that differ under mask; see compare_masked.
+ */
+template <typename Mask>
+std::size_t count_masked_mismatches(const std::uint8_t* a, const std::uint8_t* b, std::size_t n,
+                                    const Mask& mask) {
+    std::size_t count = 0;
+    for_each_masked_mismatch_range(a, b, n, mask, [&](mismatch_range r) { count += r.length; });
+    return count;
+}
+
+#endif // MASKED_COMPARE_H
@@ -0,0 +1,139 @@
+#ifndef PACKED_RECORD_H
+#define PACKED_RECORD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "check_env.h"
+#include "seq.h"
+#include "util_macro.h"
+
+/**
+ * \brief The unsigned integer type of a W-bit word.
+ */
+template <int W>
+struct packed_word;
+
+template <>
+struct packed_word<8> {
+    using type = std::uint8_t;
+};
+
+template <>
+struct packed_word<16> {
+    using type = std::uint16_t;
+};
+
+template <>
+struct packed_word<32> {
+    using type = std::uint32_t;
+};
+
+template <>
+struct packed_word<64> {
+    using type = std::uint64_t;
+};
+
+template <std::size_t I, int... Os>
+constexpr int packed_offset_at(std::integer_sequence<int, Os...>) noexcept {
+    return get_value_at<I, Os...>;
+}
+
+/**
+ * \brief Bit fields of the given widths packed into an array of W-bit words.
+ *
+ * Field 0 occupies the least significant bits of words[0] and every further
+ * field follows directly above the previous one. No field may straddle a
+ * word boundary, so each access is one load plus a shift and a mask with
+ * compile-time constants.
+ *
+ * \tparam W    The word size in bits (8, 16, 32 or 64).
+ * \tparam Bits The width of each field in bits.
+ */
+template <int W, int... Bits>
+struct packed_record {
+    using word_type = typename packed_word<W>::type;
+
+    static constexpr std::size_t field_count = sizeof...(Bits);
+    static constexpr int total_bits = (Bits + ...);
+    static_assert(((Bits > 0 && Bits <= W) && ...), "Field widths must be in [1, W]");
+    static_assert(total_bits % W == 0, "Fields must fill a whole number of words");
+    static_assert(is_word_size_aligned<W, Bits...>, "A field must not straddle a word boundary");
+
+    static constexpr std::size_t word_count = total_bits / W;
+
+    /**
+     * \brief The bit offset of each field.
+     */
+    using offsets = make_total_value_sequence<Bits...>;
+
+    /**
+     * \brief For every word boundary, the index of the field that starts there.
+     */
+    using word_indices = make_word_index_sequence<W, Bits...>;
+
+    template <std::size_t I>
+    static constexpr int offset = packed_offset_at<I>(offsets{});
+
+    template <std::size_t I>
+    static constexpr int width = get_value_at<I, Bits...>;
+
+    template <std::size_t I>
+    static constexpr word_type mask =
+        width<I> == W ? word_type(~word_type(0)) : word_type((word_type(1) << width<I>) - 1);
+
+    template <std::size_t I>
+    constexpr word_type get() const noexcept {
+        static_assert(I < field_count, "Index out of range");
+        return word_type(words[offset<I> / W] >> (offset<I> % W)) & mask<I>;
+    }
+
+    template <std::size_t I>
+    constexpr void set(word_type value) noexcept {
+        static_assert(I < field_count, "Index out of range");
+        constexpr int shift = offset<I> % W;
+        word_type& word = words[offset<I> / W];
+        word = word_type(word & word_type(~word_type(mask<I> << shift))) |
+               word_type(word_type(value & mask<I>) << shift);
+    }
+
+    // Records per batch when decoding many of them, so that a batch of
+    // records plus its decoded fields stays in the L1 data cache
+    static std::size_t decode_batch_size() { return check_env::l1_batch_size<packed_record>(4); }
+
+    // Reads the words from a record stored at any byte offset
+    void load(const void* bytes) noexcept { check_env::load_unaligned_n(bytes, words, word_count); }
+
+    // Writes the words to any byte offset
+    void store(void* bytes) const noexcept {
+        check_env::store_unaligned_n(bytes, words, word_count);
+    }
+
+    word_type words[word_count];
+};
+
+// clang-format off
+#define PACKED_RECORD_NAME(name, bits) name
+#define PACKED_RECORD_BITS(name, bits) bits
+#define PACKED_RECORD_FIELD_BITS(field) PACKED_RECORD_BITS field
+#define PACKED_RECORD_ACCESSORS(i, field) PACKED_RECORD_ACCESSORS_IMPL(i, PACKED_RECORD_NAME field)
+#define PACKED_RECORD_ACCESSORS_IMPL(i, name) \
+    constexpr word_type name() const noexcept { return get<i>(); } \
+    constexpr void UTIL_MACRO_CAT(set_, name)(word_type value) noexcept { set<i>(value); }
+
+/**
+ * \brief Declares a packed_record with a getter and setter per field, e.g.
+ *
+ *   PACKED_RECORD(Instruction, 32, (opcode, 6), (dest, 5), (src, 5), (imm, 16));
+ *
+ * declares struct Instruction with opcode()/set_opcode(v), dest()/set_dest(v),
+ * ... over one 32-bit word. Fields are given as (name, bits).
+ */
+#define PACKED_RECORD(Name, W, ...) \
+    struct Name : packed_record<W, UTIL_MACRO_MAP(PACKED_RECORD_FIELD_BITS, __VA_ARGS__)> { \
+        UTIL_MACRO_FOR_EACH_WITH_INDEX(PACKED_RECORD_ACCESSORS, __VA_ARGS__) \
+    }
+// clang-format on
+
+#endif // PACKED_RECORD_H
@@ -0,0 +1,191 @@
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+/*
+ * Compile-time perfect hashing of a fixed set of string keys
+ * (hash-and-displace).
+ *
+ * Keys are spread over about N/4 buckets. Buckets are placed largest first;
+ * each one gets the smallest displacement d for which all of its keys land
+ * in free slots at (h1 + d * h2) mod slot_count. A lookup hashes the string
+ * once, reads the displacement of its bucket, and compares against the one
+ * key stored in the resulting slot.
+ *
+ *   constexpr auto fields = make_perfect_hash({"id", "length", "payload"});
+ *   static_assert(fields.find("length") == 1);
+ */
+
+namespace tmpl_lib {
+
+namespace detail {
+
+// Smallest power of two not below n
+constexpr std::size_t ph_bit_ceil(std::size_t n) {
+    std::size_t result = 1;
+    while (result < n) {
+        result *= 2;
+    }
+    return result;
+}
+
+// FNV-1a over the whole key followed by a splitmix64 finalizer, so that
+// every bit of the result depends on every byte
+constexpr std::uint64_t ph_hash(std::string_view key, std::uint64_t seed) {
+    std::uint64_t hash = 14695981039346656037ull ^ (seed * 0x9e3779b97f4a7c15ull);
+    for (char c : key) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return hash ^ (hash >> 31);
+}
+
+}  // namespace detail
+
+/**
+ * \brief A collision-free table over N string keys, built at compile time.
+ *
+ * find(key) returns the position of key in the list the table was built
+ * from, or N if it is not one of the keys. The keys must be distinct: a
+ * table built at runtime throws std::invalid_argument otherwise, and one
+ * built in a constant expression fails to compile.
+ */
+template <std::size_t N>
+class perfect_hash {
+public:
+    static constexpr std::size_t size = N;
+    static constexpr std::size_t slot_count = detail::ph_bit_ceil(N + N / 4 + 1);
+    static constexpr std::size_t bucket_count = N / 4 + 1;
+
+    constexpr explicit perfect_hash(const std::string_view (&keys)[N]) {
+        for (std::size_t i = 0; i < N; ++i) {
+            keys_[i] = keys[i];
+        }
+        // Another seed almost always helps if a bucket cannot be placed;
+        // when none does, two keys are equal, since equal keys hash to the
+        // same slot under every displacement
+        for (seed_ = 0; seed_ < 64; ++seed_) {
+            if (build()) {
+                return;
+            }
+        }
+        throw std::invalid_argument("perfect_hash: duplicate keys");
+    }
+
+    constexpr std::size_t find(std::string_view key) const {
+        std::uint64_t hash = detail::ph_hash(key, seed_);
+        std::size_t slot = slot_of(hash, displacements_[bucket_of(hash)]);
+        std::size_t index = slots_[slot];
+        return index < N && keys_[index] == key ? index : N;
+    }
+
+    constexpr bool contains(std::string_view key) const { return find(key) != N; }
+
+    constexpr std::string_view key(std::size_t index) const { return keys_[index]; }
+
+private:
+    static constexpr std::size_t bucket_of(std::uint64_t hash) {
+        return static_cast<std::size_t>((hash >> 32) % bucket_count);
+    }
+
+    // An odd step visits every slot before repeating
+    static constexpr std::size_t slot_of(std::uint64_t hash, std::size_t displacement) {
+        std::uint64_t step = (hash >> 16) | 1;
+        return static_cast<std::size_t>((hash + displacement * step) & (slot_count - 1));
+    }
+
+    constexpr bool build() {
+        std::uint64_t hashes[N > 0 ? N : 1] = {};
+        std::size_t starts[bucket_count + 1] = {};
+        for (std::size_t i = 0; i < N; ++i) {
+            hashes[i] = detail::ph_hash(keys_[i], seed_);
+            ++starts[bucket_of(hashes[i]) + 1];
+        }
+        for (std::size_t b = 0; b < bucket_count; ++b) {
+            starts[b + 1] += starts[b];
+        }
+
+        // Keys grouped by bucket
+        std::size_t members[N > 0 ? N : 1] = {};
+        std::size_t next[bucket_count] = {};
+        for (std::size_t b = 0; b < bucket_count; ++b) {
+            next[b] = starts[b];
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            members[next[bucket_of(hashes[i])]++] = i;
+        }
+
+        // Buckets by descending size, via a counting sort on the size
+        std::size_t by_size[N + 2] = {};
+        for (std::size_t b = 0; b < bucket_count; ++b) {
+            ++by_size[N - (starts[b + 1] - starts[b]) + 1];
+        }
+        for (std::size_t s = 0; s <= N; ++s) {
+            by_size[s + 1] += by_size[s];
+        }
+        std::size_t order[bucket_count] = {};
+        for (std::size_t b = 0; b < bucket_count; ++b) {
+            order[by_size[N - (starts[b + 1] - starts[b])]++] = b;
+        }
+
+        for (std::size_t s = 0; s < slot_count; ++s) {
+            slots_[s] = N;
+        }
+        for (std::size_t o = 0; o < bucket_count; ++o) {
+            std::size_t b = order[o];
+            if (starts[b] == starts[b + 1]) {
+                break;
+            }
+            if (!place(b, hashes, members + starts[b], starts[b + 1] - starts[b])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Finds a displacement that puts all count members of bucket b in free,
+    // distinct slots and claims them
+    constexpr bool place(std::size_t b, const std::uint64_t* hashes, const std::size_t* members,
+                         std::size_t count) {
+        for (std::size_t d = 0; d < slot_count; ++d) {
+            bool fits = true;
+            for (std::size_t k = 0; k < count && fits; ++k) {
+                std::size_t slot = slot_of(hashes[members[k]], d);
+                fits = slots_[slot] == N;
+                for (std::size_t j = 0; j < k && fits; ++j) {
+                    fits = slot_of(hashes[members[j]], d) != slot;
+                }
+            }
+            if (fits) {
+                for (std::size_t k = 0; k < count; ++k) {
+                    slots_[slot_of(hashes[members[k]], d)] = members[k];
+                }
+                displacements_[b] = d;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string_view keys_[N > 0 ? N : 1] = {};
+    std::size_t slots_[slot_count] = {};
+    std::size_t displacements_[bucket_count] = {};
+    std::uint64_t seed_ = 0;
+};
+
+/**
+ * \brief Builds a perfect_hash over keys; usable in constant expressions.
+ */
+template <std::size_t N>
+constexpr perfect_hash<N> make_perfect_hash(const std::string_view (&keys)[N]) {
+    return perfect_hash<N>(keys);
+}
+
+}  // namespace tmpl_lib
+
+#endif  // PERFECT_HASH_H
@@ -4,6 +4,8 @@
 #include <type_traits>
 #include <utility>
 #include <array>
+#include <cstddef>
+#include <stdexcept>
 
 /**
  * \brief Helper struct for generating a sequence of total values.
@@ -36,6 +38,27 @@ struct total_seq_helper {
         return (void)((value = Vs, I == cur_index++) || ...), value;
     }
 
+    /**
+     * \brief The values of the sequence as an array.
+     */
+    static constexpr std::array<int, sizeof...(Vs)> values = {Vs...};
+
+    /**
+     * \brief Gets the value at a runtime index.
+     *
+     * Reads the values array, so the index does not need to be a constant.
+     *
+     * \param i The index.
+     * \return The value at the specified index.
+     * \throws std::out_of_range if i is not below the number of values.
+     */
+    static constexpr int value_at(std::size_t i) {
+        if (i >= sizeof...(Vs)) {
+            throw std::out_of_range("value_at: index out of range");
+        }
+        return values[i];
+    }
+
     /**
      * \brief Generates the total value at the specified index.
      *
@@ -178,6 +201,18 @@ struct total_seq_helper {
 template <std::size_t I, int... Vs>
 auto static constexpr get_value_at = total_seq_helper<Vs...>::template get_value_at<I>();
 
+/**
+ * \brief gets the value at a runtime index.
+ *
+ * \tparam Vs  The values in the sequence
+ * \param i    The index
+ * \throws std::out_of_range if i is not below sizeof...(Vs)
+ */
+template <int... Vs>
+constexpr int value_at(std::size_t i) {
+    return total_seq_helper<Vs...>::value_at(i);
+}
+
 /**
  * \brief Alias template for generating a sequence of total values.
  *
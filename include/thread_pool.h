@@ -0,0 +1,155 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "check_env.h"
+
+/**
+ * \brief A fixed set of worker threads that run parallel loops.
+ *
+ * parallel_for(count, f) calls f(i) for every i in [0, count) on the
+ * workers and the calling thread, and returns once all calls are done.
+ * Indices are handed out one at a time in ascending order, so uneven work
+ * balances itself and a loop over chunks of a buffer walks it front to
+ * back. The first exception thrown by f stops handing out indices and is
+ * rethrown by parallel_for.
+ *
+ * One loop runs at a time; f must not start another loop on the same pool.
+ */
+class thread_pool {
+public:
+    // threads counts the calling thread, so a pool of 1 runs loops inline
+    explicit thread_pool(unsigned threads = check_env::worker_thread_count()) {
+        for (unsigned i = 1; i < threads; ++i) {
+            workers_.emplace_back([this] { work(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Threads that take part in a loop, including the caller
+    unsigned size() const noexcept { return static_cast<unsigned>(workers_.size()) + 1; }
+
+    template <typename F>
+    void parallel_for(std::size_t count, F&& f) {
+        if (count == 0) {
+            return;
+        }
+        using fn_type = std::remove_reference_t<F>;
+        job current(count, &f, [](const void* fn, std::size_t i) {
+            (*static_cast<fn_type*>(const_cast<void*>(fn)))(i);
+        });
+
+        std::lock_guard<std::mutex> one_loop(loop_mutex_);
+        if (!workers_.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                job_ = &current;
+                active_ = workers_.size();
+                ++generation_;
+            }
+            wake_.notify_all();
+        }
+        run(current);
+        if (!workers_.empty()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [this] { return active_ == 0; });
+            job_ = nullptr;
+        }
+        if (current.error) {
+            std::rethrow_exception(current.error);
+        }
+    }
+
+    // A process-wide pool with check_env::worker_thread_count() threads
+    static thread_pool& shared() {
+        static thread_pool pool;
+        return pool;
+    }
+
+private:
+    struct job {
+        job(std::size_t count, const void* fn, void (*body)(const void*, std::size_t))
+            : count(count), fn(fn), body(body) {}
+
+        std::size_t count;
+        const void* fn;
+        void (*body)(const void*, std::size_t);
+        std::atomic<std::size_t> next{0};
+        std::mutex error_mutex;
+        std::exception_ptr error;
+    };
+
+    static void run(job& current) noexcept {
+        for (;;) {
+            std::size_t i = current.next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= current.count) {
+                return;
+            }
+            try {
+                current.body(current.fn, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(current.error_mutex);
+                if (!current.error) {
+                    current.error = std::current_exception();
+                }
+                current.next.store(current.count, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void work() {
+        std::size_t seen = 0;
+        for (;;) {
+            job* current;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) {
+                    return;
+                }
+                seen = generation_;
+                current = job_;
+            }
+            run(*current);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--active_ == 0) {
+                    done_.notify_one();
+                }
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex loop_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    job* job_ = nullptr;
+    std::size_t active_ = 0;
+    std::size_t generation_ = 0;
+    bool stop_ = false;
+};
+
+#endif // THREAD_POOL_H
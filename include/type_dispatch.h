@@ -0,0 +1,162 @@
+#ifndef TYPE_DISPATCH_H
+#define TYPE_DISPATCH_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "type_map.h"
+
+/*
+ * Runtime dispatch from a registry id to a handler templated on the type.
+ *
+ * Every (registry, handler) pair gets one constexpr array of function
+ * pointers, one entry per registered type, so a call is a bounds check, one
+ * load and one indirect call. An id outside the registry throws
+ * std::out_of_range before any handler runs. Handlers are called as
+ * f(type_tag<T>{}, args...), e.g.
+ *
+ *   dispatch(id, [](auto tag) { using T = typename decltype(tag)::type; ... });
+ */
+
+namespace tmpl_lib {
+
+/**
+ * \brief Names the type a dispatched id maps to.
+ */
+template <typename T>
+struct type_tag {
+    using type = T;
+};
+
+namespace detail {
+
+template <typename T, typename R, typename F, typename... Args>
+R td_call(F& f, Args&&... args) {
+    return static_cast<R>(f(type_tag<T>{}, std::forward<Args>(args)...));
+}
+
+template <typename List, typename R, typename F, typename... Args>
+struct td_table;
+
+template <typename... Ts, typename R, typename F, typename... Args>
+struct td_table<type_list<Ts...>, R, F, Args...> {
+    static constexpr R (*entries[])(F&, Args&&...) = {&td_call<Ts, R, F, Args...>...};
+};
+
+// Calls f on count payloads of type T, picked from first by positions
+template <typename T, typename F, typename It>
+void td_call_group(F& f, It first, const std::size_t* positions, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        f(type_tag<T>{}, std::get<1>(first[positions[i]]));
+    }
+}
+
+template <typename List, typename F, typename It>
+struct td_group_table;
+
+template <typename... Ts, typename F, typename It>
+struct td_group_table<type_list<Ts...>, F, It> {
+    static constexpr void (*entries[])(F&, It, const std::size_t*, std::size_t) = {
+        &td_call_group<Ts, F, It>...};
+};
+
+}  // namespace detail
+
+/**
+ * \brief Calls f(type_tag<T>{}, args...) for the type T at runtime index i of List.
+ *
+ * The result is that of the call for the first type; the other calls must
+ * return something convertible to it. Throws std::out_of_range if i is not
+ * below the size of List.
+ */
+template <typename List, typename F, typename... Args>
+decltype(auto) visit_at(std::size_t i, F&& f, Args&&... args) {
+    static_assert(detail::tl_size<List>::value > 0, "Cannot visit an empty type_list");
+    using result = std::invoke_result_t<F&, type_tag<at_t<0, List>>, Args&&...>;
+    if (i >= detail::tl_size<List>::value) {
+        throw std::out_of_range("visit_at: type index out of range");
+    }
+    return detail::td_table<List, result, std::remove_reference_t<F>, Args...>::entries[i](
+        f, std::forward<Args>(args)...);
+}
+
+/**
+ * \brief Calls f(type_tag<T>{}, args...) for the type T that id names in Registry.
+ *
+ * Same as visit_at over Registry::types; throws std::out_of_range if
+ * Registry does not contain id, e.g. for the count that type_id_from_name
+ * returns for an unknown name.
+ */
+template <typename Registry, typename F, typename... Args>
+decltype(auto) dispatch(typename Registry::id_type id, F&& f, Args&&... args) {
+    return visit_at<typename Registry::types>(static_cast<std::size_t>(id), std::forward<F>(f),
+                                              std::forward<Args>(args)...);
+}
+
+/**
+ * \brief dispatch over MyTypeRegistry.
+ */
+template <typename F, typename... Args>
+decltype(auto) dispatch(TypeId id, F&& f, Args&&... args) {
+    return dispatch<MyTypeRegistry>(id, std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+/**
+ * \brief Calls f(type_tag<T>{}, payload) for every (id, payload) item in [first, last).
+ *
+ * Items are tuple-like (e.g. std::pair<Id, Payload>) and are grouped by id
+ * with a counting sort before any handler runs, so each type costs one
+ * indirect call and its handler then runs over all of its items back to
+ * back. Items of the same id keep their relative order; ids are visited in
+ * ascending order. If any item's id is out of range, std::out_of_range is
+ * thrown before any handler runs.
+ */
+template <typename Registry, typename It, typename F>
+void dispatch_batch(It first, It last, F&& f) {
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                    typename std::iterator_traits<It>::iterator_category>,
+                  "dispatch_batch requires random access iterators");
+    constexpr std::size_t size = Registry::size;
+    std::size_t count = static_cast<std::size_t>(last - first);
+
+    std::vector<std::size_t> starts(size + 1, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!Registry::contains(std::get<0>(first[i]))) {
+            throw std::out_of_range("dispatch_batch: id out of range");
+        }
+        ++starts[static_cast<std::size_t>(std::get<0>(first[i])) + 1];
+    }
+    for (std::size_t t = 0; t < size; ++t) {
+        starts[t + 1] += starts[t];
+    }
+
+    std::vector<std::size_t> positions(count);
+    std::vector<std::size_t> next(starts.begin(), starts.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        positions[next[static_cast<std::size_t>(std::get<0>(first[i]))]++] = i;
+    }
+
+    using table = detail::td_group_table<typename Registry::types, std::remove_reference_t<F>, It>;
+    for (std::size_t t = 0; t < size; ++t) {
+        if (starts[t + 1] != starts[t]) {
+            table::entries[t](f, first, positions.data() + starts[t], starts[t + 1] - starts[t]);
+        }
+    }
+}
+
+/**
+ * \brief dispatch_batch over MyTypeRegistry.
+ */
+template <typename It, typename F>
+void dispatch_batch(It first, It last, F&& f) {
+    dispatch_batch<MyTypeRegistry>(first, last, std::forward<F>(f));
+}
+
+}  // namespace tmpl_lib
+
+#endif  // TYPE_DISPATCH_H
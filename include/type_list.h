@@ -0,0 +1,675 @@
+#ifndef TYPE_LIST_H
+#define TYPE_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Type-list algorithms that stay fast for very large lists (10,000+ types).
+ *
+ * Nothing here recurses once per element. Lookups by index go through
+ * __type_pack_element where the compiler has it, and otherwise through a
+ * 16-ary tree of nodes built once per list, so a lookup costs one class
+ * template specialization per tree level. Algorithms that reorder or drop
+ * elements (filter, sort_by, unique) compute the resulting positions with
+ * constexpr loops over plain arrays and then gather the types in a single
+ * pack expansion.
+ */
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define TMPL_LIB_HAS_TYPE_PACK_ELEMENT 1
+#endif
+#if __has_builtin(__is_same)
+#define TMPL_LIB_HAS_IS_SAME 1
+#endif
+#endif
+
+#ifndef TMPL_LIB_HAS_TYPE_PACK_ELEMENT
+#define TMPL_LIB_HAS_TYPE_PACK_ELEMENT 0
+#endif
+
+#ifndef TMPL_LIB_HAS_IS_SAME
+#define TMPL_LIB_HAS_IS_SAME 0
+#endif
+
+namespace tmpl_lib {
+
+/**
+ * \brief A list of types.
+ */
+template <typename... Ts>
+struct type_list {
+    static constexpr std::size_t size = sizeof...(Ts);
+};
+
+namespace detail {
+
+// GCC spends time quadratic in the length of a list on every static data
+// member (and function) whose name carries the list, about half a second each
+// at 10,000 types. The helpers below therefore expose their results as
+// enumerators and types, and each plan holds exactly one data member.
+template <typename List>
+struct tl_size;
+
+template <typename... Ts>
+struct tl_size<type_list<Ts...>> {
+    enum : std::size_t { value = sizeof...(Ts) };
+};
+
+// The builtin is used directly inside pack expansions, which saves one
+// variable template instantiation per element
+#if TMPL_LIB_HAS_IS_SAME
+#define TMPL_LIB_TL_SAME(T, U) __is_same(T, U)
+#else
+#define TMPL_LIB_TL_SAME(T, U) std::is_same_v<T, U>
+#endif
+
+// Fills the unused slots of a partially-filled tree node
+struct tl_nil {};
+
+// One node of the lookup tree
+template <typename T0 = tl_nil, typename T1 = tl_nil, typename T2 = tl_nil, typename T3 = tl_nil,
+          typename T4 = tl_nil, typename T5 = tl_nil, typename T6 = tl_nil, typename T7 = tl_nil,
+          typename T8 = tl_nil, typename T9 = tl_nil, typename T10 = tl_nil,
+          typename T11 = tl_nil, typename T12 = tl_nil, typename T13 = tl_nil,
+          typename T14 = tl_nil, typename T15 = tl_nil>
+struct tl_node {};
+
+// Slot I of a node is one partial specialization match
+template <std::size_t I, typename Node>
+struct tl_node_get;
+
+// clang-format off
+#define TMPL_LIB_TL_PARAMS(p) \
+    typename p##0, typename p##1, typename p##2, typename p##3, typename p##4, typename p##5, \
+    typename p##6, typename p##7, typename p##8, typename p##9, typename p##10, typename p##11, \
+    typename p##12, typename p##13, typename p##14, typename p##15
+#define TMPL_LIB_TL_ARGS(p) \
+    p##0, p##1, p##2, p##3, p##4, p##5, p##6, p##7, p##8, p##9, p##10, p##11, p##12, p##13, \
+    p##14, p##15
+// clang-format on
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<0, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T0;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<1, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T1;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<2, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T2;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<3, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T3;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<4, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T4;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<5, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T5;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<6, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T6;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<7, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T7;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<8, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T8;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<9, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T9;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<10, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T10;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<11, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T11;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<12, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T12;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<13, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T13;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<14, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T14;
+};
+
+template <TMPL_LIB_TL_PARAMS(T)>
+struct tl_node_get<15, tl_node<TMPL_LIB_TL_ARGS(T)>> {
+    using type = T15;
+};
+
+template <typename List, typename... Nodes>
+struct tl_prepend;
+
+template <typename... Rest, typename... Nodes>
+struct tl_prepend<type_list<Rest...>, Nodes...> {
+    using type = type_list<Nodes..., Rest...>;
+};
+
+// Groups Ts into nodes of 16. Each step peels up to 64 elements, so the
+// recursion depth is N / 64 and the pack copies add up to about N^2 / 128
+// template arguments.
+template <typename... Ts>
+struct tl_chunk {
+    using type = type_list<tl_node<Ts...>>;
+};
+
+template <>
+struct tl_chunk<> {
+    using type = type_list<>;
+};
+
+template <TMPL_LIB_TL_PARAMS(A), typename... Rest>
+struct tl_chunk<TMPL_LIB_TL_ARGS(A), Rest...> {
+    using type = typename tl_prepend<typename tl_chunk<Rest...>::type,
+                                     tl_node<TMPL_LIB_TL_ARGS(A)>>::type;
+};
+
+template <TMPL_LIB_TL_PARAMS(A), TMPL_LIB_TL_PARAMS(B), TMPL_LIB_TL_PARAMS(C),
+          TMPL_LIB_TL_PARAMS(D), typename... Rest>
+struct tl_chunk<TMPL_LIB_TL_ARGS(A), TMPL_LIB_TL_ARGS(B), TMPL_LIB_TL_ARGS(C),
+                TMPL_LIB_TL_ARGS(D), Rest...> {
+    using type = typename tl_prepend<typename tl_chunk<Rest...>::type,
+                                     tl_node<TMPL_LIB_TL_ARGS(A)>, tl_node<TMPL_LIB_TL_ARGS(B)>,
+                                     tl_node<TMPL_LIB_TL_ARGS(C)>,
+                                     tl_node<TMPL_LIB_TL_ARGS(D)>>::type;
+};
+
+#undef TMPL_LIB_TL_PARAMS
+#undef TMPL_LIB_TL_ARGS
+
+// Chunks each level again until a single root node is left
+template <std::size_t Depth, typename Nodes>
+struct tl_build;
+
+template <std::size_t Depth, typename Root>
+struct tl_build<Depth, type_list<Root>> {
+    enum : std::size_t { depth = Depth };
+    using root = Root;
+};
+
+template <std::size_t Depth, typename... Nodes>
+struct tl_build<Depth, type_list<Nodes...>>
+    : tl_build<Depth + 1, typename tl_chunk<Nodes...>::type> {};
+
+template <typename List>
+struct tl_tree;
+
+template <typename... Ts>
+struct tl_tree<type_list<Ts...>> : tl_build<1, typename tl_chunk<Ts...>::type> {};
+
+template <>
+struct tl_tree<type_list<>> {
+    enum : std::size_t { depth = 1 };
+    using root = tl_node<>;
+};
+
+template <std::size_t I, typename Node>
+using tl_get = typename tl_node_get<I, Node>::type;
+
+// Root-to-leaf walk spelled out per depth, so nothing is instantiated besides
+// the tl_node_get specializations; six levels cover 16M types
+template <std::size_t Depth>
+struct tl_tree_at;
+
+template <>
+struct tl_tree_at<1> {
+    template <std::size_t I, typename R>
+    using at = tl_get<I, R>;
+};
+
+template <>
+struct tl_tree_at<2> {
+    template <std::size_t I, typename R>
+    using at = tl_get<I % 16, tl_get<I / 16, R>>;
+};
+
+template <>
+struct tl_tree_at<3> {
+    template <std::size_t I, typename R>
+    using at = tl_get<I % 16, tl_get<I / 16 % 16, tl_get<I / 256, R>>>;
+};
+
+template <>
+struct tl_tree_at<4> {
+    template <std::size_t I, typename R>
+    using at = tl_get<I % 16, tl_get<I / 16 % 16, tl_get<I / 256 % 16, tl_get<I / 4096, R>>>>;
+};
+
+template <>
+struct tl_tree_at<5> {
+    template <std::size_t I, typename R>
+    using at = tl_get<I % 16, tl_get<I / 16 % 16, tl_get<I / 256 % 16,
+                      tl_get<I / 4096 % 16, tl_get<I / 65536, R>>>>>;
+};
+
+template <>
+struct tl_tree_at<6> {
+    template <std::size_t I, typename R>
+    using at = tl_get<I % 16, tl_get<I / 16 % 16, tl_get<I / 256 % 16, tl_get<I / 4096 % 16,
+                      tl_get<I / 65536 % 16, tl_get<I / 1048576, R>>>>>>;
+};
+
+// type_list<element Is...> of List in one pack expansion
+template <typename List, typename Indices>
+struct tl_gather;
+
+#if TMPL_LIB_HAS_TYPE_PACK_ELEMENT
+template <typename... Ts, std::size_t... Is>
+struct tl_gather<type_list<Ts...>, std::index_sequence<Is...>> {
+    using type = type_list<__type_pack_element<Is, Ts...>...>;
+};
+#else
+template <typename List, std::size_t... Is>
+struct tl_gather<List, std::index_sequence<Is...>> {
+    using tree = tl_tree<List>;
+    using type = type_list<
+        typename tl_tree_at<tree::depth>::template at<Is, typename tree::root>...>;
+};
+#endif
+
+template <typename List>
+struct tl_front;
+
+template <typename T, typename... Ts>
+struct tl_front<type_list<T, Ts...>> {
+    using type = T;
+};
+
+// Fixed-size array for the constexpr passes below. GCC evaluates subscripts
+// of a built-in array roughly ten times faster than std::array::operator[]
+// or pointer arithmetic, which matters at 10,000+ elements.
+template <typename T, std::size_t N>
+struct tl_array {
+    T values[N > 0 ? N : 1];
+};
+
+// The first count entries of values are positions into a list of N types
+template <std::size_t N>
+struct tl_positions {
+    std::size_t count;
+    std::size_t values[N > 0 ? N : 1];
+};
+
+// A plan is a struct with a static tl_positions member `positions` and an
+// enumerator `count` equal to positions.count
+template <typename Plan, typename Indices>
+struct tl_plan_sequence;
+
+template <typename Plan, std::size_t... Is>
+struct tl_plan_sequence<Plan, std::index_sequence<Is...>> {
+    using type = std::index_sequence<Plan::positions.values[Is]...>;
+};
+
+template <typename List, typename Plan>
+using tl_apply_plan_t = typename tl_gather<
+    List,
+    typename tl_plan_sequence<Plan, std::make_index_sequence<Plan::count>>::type>::type;
+
+// Stable bottom-up merge sort of the positions [0, N) by keys, ping-ponging
+// between two buffers
+template <std::size_t N, typename Key>
+constexpr tl_positions<N> tl_stable_order(const tl_array<Key, N>& keys, bool descending) {
+    tl_positions<N> order{N, {}};
+    std::size_t buffers[2][N > 0 ? N : 1] = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        buffers[0][i] = i;
+    }
+    std::size_t from = 0;
+    for (std::size_t width = 1; width < N; width *= 2) {
+        std::size_t to = 1 - from;
+        for (std::size_t lo = 0; lo < N; lo += 2 * width) {
+            std::size_t mid = lo + width < N ? lo + width : N;
+            std::size_t hi = lo + 2 * width < N ? lo + 2 * width : N;
+            std::size_t i = lo;
+            std::size_t j = mid;
+            std::size_t k = lo;
+            while (i < mid && j < hi) {
+                bool take_right =
+                    descending ? keys.values[buffers[from][i]] < keys.values[buffers[from][j]]
+                               : keys.values[buffers[from][j]] < keys.values[buffers[from][i]];
+                buffers[to][k++] = take_right ? buffers[from][j++] : buffers[from][i++];
+            }
+            while (i < mid) {
+                buffers[to][k++] = buffers[from][i++];
+            }
+            while (j < hi) {
+                buffers[to][k++] = buffers[from][j++];
+            }
+        }
+        from = to;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        order.values[i] = buffers[from][i];
+    }
+    return order;
+}
+
+// Positions whose flag is set, in order
+template <std::size_t N>
+constexpr tl_positions<N> tl_select(const tl_array<bool, N>& keep) {
+    tl_positions<N> result{0, {}};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (keep.values[i]) {
+            result.values[result.count++] = i;
+        }
+    }
+    return result;
+}
+
+// Plans are keyed by the list type rather than by packs of per-element
+// values: naming a template with 10,000 value arguments costs a pass over all
+// of them every time it is mentioned.
+template <typename List, template <typename> class Pred>
+struct tl_filter_plan;
+
+template <typename... Ts, template <typename> class Pred>
+struct tl_filter_plan<type_list<Ts...>, Pred> {
+    static constexpr tl_positions<sizeof...(Ts)> positions =
+        tl_select(tl_array<bool, sizeof...(Ts)>{{bool(Pred<Ts>::value)...}});
+    enum : std::size_t { count = positions.count };
+};
+
+template <typename List, template <typename> class Key, bool Descending>
+struct tl_sort_plan;
+
+template <typename... Ts, template <typename> class Key, bool Descending>
+struct tl_sort_plan<type_list<Ts...>, Key, Descending> {
+    static constexpr tl_positions<sizeof...(Ts)> positions = tl_stable_order(
+        tl_array<std::intmax_t, sizeof...(Ts)>{{static_cast<std::intmax_t>(Key<Ts>::value)...}},
+        Descending);
+    enum : std::size_t { count = sizeof...(Ts) };
+};
+
+template <std::size_t N>
+constexpr std::size_t tl_find_first(const tl_array<bool, N>& flags) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (flags.values[i]) {
+            return i;
+        }
+    }
+    return N;
+}
+
+template <typename T, typename... Ts>
+struct tl_index_of {
+    enum : std::size_t {
+        value = tl_find_first(tl_array<bool, sizeof...(Ts)>{{TMPL_LIB_TL_SAME(T, Ts)...}})
+    };
+};
+
+// FNV-1a over the tail of the compiler's spelling of T, seeded with its
+// length; hashing every character of 10,000 names dominates the compile time
+// otherwise. Only used to bucket types for unique; equality is always decided
+// by is_same, so collisions (long names that differ early, lambdas that print
+// alike) cost time, never correctness.
+template <typename T>
+constexpr unsigned long long tl_type_hash() {
+#if defined(__clang__) || defined(__GNUC__)
+    const char* name = __PRETTY_FUNCTION__;
+    std::size_t length = sizeof(__PRETTY_FUNCTION__) - 1;
+#elif defined(_MSC_VER)
+    const char* name = __FUNCSIG__;
+    std::size_t length = sizeof(__FUNCSIG__) - 1;
+#else
+    const char* name = "";
+    std::size_t length = 0;
+#endif
+    constexpr std::size_t tail = 48;
+    unsigned long long hash = 14695981039346656037ull ^ length;
+    for (std::size_t i = length > tail ? length - tail : 0; i < length; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(name[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// For every position, the first position with the same hash
+template <std::size_t N>
+constexpr tl_positions<N> tl_bucket_leaders(const tl_array<unsigned long long, N>& hashes) {
+    tl_positions<N> leader{N, {}};
+    tl_positions<N> order = tl_stable_order(hashes, false);
+    std::size_t first = order.values[0];
+    for (std::size_t i = 0; i < N; ++i) {
+        if (hashes.values[order.values[i]] != hashes.values[first]) {
+            first = order.values[i];
+        }
+        leader.values[order.values[i]] = first;
+    }
+    return leader;
+}
+
+// Gathering this plan gives the bucket leader of every element
+template <typename List>
+struct tl_bucket_plan;
+
+template <typename... Ts>
+struct tl_bucket_plan<type_list<Ts...>> {
+    static constexpr tl_positions<sizeof...(Ts)> positions =
+        tl_bucket_leaders(tl_array<unsigned long long, sizeof...(Ts)>{{tl_type_hash<Ts>()...}});
+    enum : std::size_t { count = sizeof...(Ts) };
+};
+
+// Positions whose type differs from their bucket leader (hash collisions)
+template <typename List, typename Leaders>
+struct tl_collision_plan;
+
+template <typename... Ts, typename... Ls>
+struct tl_collision_plan<type_list<Ts...>, type_list<Ls...>> {
+    static constexpr tl_positions<sizeof...(Ts)> positions =
+        tl_select(tl_array<bool, sizeof...(Ts)>{{!TMPL_LIB_TL_SAME(Ts, Ls)...}});
+    enum : std::size_t { count = positions.count };
+};
+
+// Keeps position i when it is the first occurrence of its type: settled by
+// the bucket leader unless i collided, in which case firsts (the first
+// position of each collided type, in order) decides
+template <std::size_t N, std::size_t C>
+constexpr tl_positions<N> tl_unique_select(const tl_positions<N>& leaders,
+                                           const tl_positions<N>& collisions,
+                                           const tl_array<std::size_t, C>& firsts) {
+    tl_positions<N> result{0, {}};
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        bool collided = c < collisions.count && collisions.values[c] == i;
+        bool keep = collided ? firsts.values[c++] == i : leaders.values[i] == i;
+        if (keep) {
+            result.values[result.count++] = i;
+        }
+    }
+    return result;
+}
+
+template <typename List, typename Collided>
+struct tl_unique_plan;
+
+template <typename... Ts, typename... Cs>
+struct tl_unique_plan<type_list<Ts...>, type_list<Cs...>> {
+    using collision_plan =
+        tl_collision_plan<type_list<Ts...>,
+                          tl_apply_plan_t<type_list<Ts...>, tl_bucket_plan<type_list<Ts...>>>>;
+
+    static constexpr tl_positions<sizeof...(Ts)> positions = tl_unique_select(
+        tl_bucket_plan<type_list<Ts...>>::positions, collision_plan::positions,
+        tl_array<std::size_t, sizeof...(Cs)>{{tl_index_of<Cs, Ts...>::value...}});
+    enum : std::size_t { count = positions.count };
+};
+
+template <typename... Lists>
+struct tl_concat;
+
+template <>
+struct tl_concat<> {
+    using type = type_list<>;
+};
+
+template <typename... Ts>
+struct tl_concat<type_list<Ts...>> {
+    using type = type_list<Ts...>;
+};
+
+template <typename... Ts, typename... Us, typename... Rest>
+struct tl_concat<type_list<Ts...>, type_list<Us...>, Rest...>
+    : tl_concat<type_list<Ts..., Us...>, Rest...> {};
+
+template <typename... Ts, typename... Us, typename... Vs, typename... Ws, typename... Rest>
+struct tl_concat<type_list<Ts...>, type_list<Us...>, type_list<Vs...>, type_list<Ws...>,
+                 Rest...> : tl_concat<type_list<Ts..., Us..., Vs..., Ws...>, Rest...> {};
+
+}  // namespace detail
+
+/**
+ * \brief The type at position I of List.
+ *
+ * \tparam I    The index.
+ * \tparam List A type_list.
+ */
+template <std::size_t I, typename List>
+struct at {
+    static_assert(I < detail::tl_size<List>::value, "Index out of range");
+    using type = typename detail::tl_front<
+        typename detail::tl_gather<List, std::index_sequence<I>>::type>::type;
+};
+
+template <std::size_t I, typename List>
+using at_t = typename at<I, List>::type;
+
+/**
+ * \brief Position of the first T in List, or List::size if there is none.
+ */
+template <typename T, typename List>
+struct index_of;
+
+template <typename T, typename... Ts>
+struct index_of<T, type_list<Ts...>>
+    : std::integral_constant<std::size_t, detail::tl_index_of<T, Ts...>::value> {};
+
+template <typename T, typename List>
+constexpr std::size_t index_of_v = index_of<T, List>::value;
+
+template <typename T, typename List>
+constexpr bool contains_v = index_of<T, List>::value < detail::tl_size<List>::value;
+
+/**
+ * \brief Concatenation of any number of type_lists.
+ *
+ * Joins four lists per step, so the recursion depth is a quarter of the
+ * number of lists and does not depend on their length.
+ */
+template <typename... Lists>
+struct concat {
+    using type = typename detail::tl_concat<Lists...>::type;
+};
+
+template <typename... Lists>
+using concat_t = typename concat<Lists...>::type;
+
+/**
+ * \brief The elements T of List for which Pred<T>::value is true, in order.
+ */
+template <typename List, template <typename> class Pred>
+struct filter;
+
+template <typename... Ts, template <typename> class Pred>
+struct filter<type_list<Ts...>, Pred> {
+    using type =
+        detail::tl_apply_plan_t<type_list<Ts...>, detail::tl_filter_plan<type_list<Ts...>, Pred>>;
+};
+
+template <typename List, template <typename> class Pred>
+using filter_t = typename filter<List, Pred>::type;
+
+/**
+ * \brief Stable sort of List by the integral key Key<T>::value.
+ *
+ * Keys are compared as std::intmax_t.
+ *
+ * \tparam Descending Largest key first when true.
+ */
+template <typename List, template <typename> class Key, bool Descending = false>
+struct sort_by;
+
+template <typename... Ts, template <typename> class Key, bool Descending>
+struct sort_by<type_list<Ts...>, Key, Descending> {
+    using type = detail::tl_apply_plan_t<type_list<Ts...>,
+                                         detail::tl_sort_plan<type_list<Ts...>, Key, Descending>>;
+};
+
+template <typename List, template <typename> class Key, bool Descending = false>
+using sort_by_t = typename sort_by<List, Key, Descending>::type;
+
+template <typename T>
+struct size_key : std::integral_constant<std::size_t, sizeof(T)> {};
+
+template <typename T>
+struct alignment_key : std::integral_constant<std::size_t, alignof(T)> {};
+
+// Largest first; equal keys keep their order
+template <typename List>
+using sort_by_size_t = sort_by_t<List, size_key, true>;
+
+template <typename List>
+using sort_by_alignment_t = sort_by_t<List, alignment_key, true>;
+
+/**
+ * \brief List without repeated types; the first occurrence of each is kept.
+ *
+ * Runs in O(N log N) constexpr steps plus one is_same per element: types are
+ * bucketed by a hash of their name and compared against their bucket leader.
+ */
+template <typename List>
+struct unique;
+
+template <typename... Ts>
+struct unique<type_list<Ts...>> {
+private:
+    using list = type_list<Ts...>;
+    using leaders = detail::tl_apply_plan_t<list, detail::tl_bucket_plan<list>>;
+    using collided =
+        detail::tl_apply_plan_t<list, detail::tl_collision_plan<list, leaders>>;
+
+public:
+    using type = detail::tl_apply_plan_t<list, detail::tl_unique_plan<list, collided>>;
+};
+
+template <typename List>
+using unique_t = typename unique<List>::type;
+
+}  // namespace tmpl_lib
+
+#undef TMPL_LIB_TL_SAME
+
+#endif  // TYPE_LIST_H
@@ -2,22 +2,139 @@
 
 #include <type_traits>
 #include <cstddef>
+#include <string_view>
+#include "perfect_hash.h"
+#include "type_list.h"
 
 namespace tmpl_lib {
 
-// Helper to generate a type list
-template <typename...>
-struct type_list {};
+namespace detail {
 
-// Example: Define your types here
-struct TypeA {};
-struct TypeB {};
-struct TypeC {};
+// Hashes of a list's types in ascending order, with the position each came
+// from; equal hashes keep their list order
+template <std::size_t N>
+struct tm_hash_index {
+    unsigned long long hashes[N > 0 ? N : 1];
+    std::size_t positions[N > 0 ? N : 1];
+};
+
+template <std::size_t N>
+constexpr tm_hash_index<N> tm_make_hash_index(const tl_array<unsigned long long, N>& hashes) {
+    tm_hash_index<N> index{};
+    tl_positions<N> order = tl_stable_order(hashes, false);
+    for (std::size_t i = 0; i < N; ++i) {
+        index.hashes[i] = hashes.values[order.values[i]];
+        index.positions[i] = order.values[i];
+    }
+    return index;
+}
+
+// Position of the first type hashed to hash, or N if there is none
+template <std::size_t N>
+constexpr std::size_t tm_find_hash(const tm_hash_index<N>& index, unsigned long long hash) {
+    std::size_t lo = 0;
+    std::size_t hi = N;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (index.hashes[mid] < hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < N && index.hashes[lo] == hash ? index.positions[lo] : N;
+}
+
+template <typename List>
+struct tm_hash_table;
+
+template <typename... Ts>
+struct tm_hash_table<type_list<Ts...>> {
+    static constexpr tm_hash_index<sizeof...(Ts)> index = tm_make_hash_index(
+        tl_array<unsigned long long, sizeof...(Ts)>{{tl_type_hash<Ts>()...}});
+};
+
+// Whether I is in range and names T
+template <typename List, std::size_t I, typename T, bool = (I < std::size_t{tl_size<List>::value})>
+struct tm_names : std::false_type {};
+
+template <typename List, std::size_t I, typename T>
+struct tm_names<List, I, T, true> : std::is_same<at_t<I, List>, T> {};
+
+// Position of T in List, or List::size. One hash and a binary search find
+// the candidate and one is_same confirms it; only types whose hash collides
+// with an earlier one fall back to a scan of the list.
+template <typename List, typename T>
+struct tm_index_of;
+
+template <typename... Ts, typename T>
+struct tm_index_of<type_list<Ts...>, T> {
+    enum : std::size_t {
+        candidate =
+            tm_find_hash(tm_hash_table<type_list<Ts...>>::index, tl_type_hash<T>())
+    };
+    enum : std::size_t {
+        value = std::conditional_t<tm_names<type_list<Ts...>, candidate, T>::value,
+                                   std::integral_constant<std::size_t, candidate>,
+                                   tl_index_of<T, Ts...>>::value
+    };
+};
+
+}  // namespace detail
+
+// Dense ids [0, size) for the types of List, in list order. Id is an
+// integral type or an enum over std::size_t-compatible values.
+template <typename List, typename Id = std::size_t>
+struct type_registry;
+
+template <typename... Ts, typename Id>
+struct type_registry<type_list<Ts...>, Id> {
+    static_assert(std::is_integral_v<Id> || std::is_enum_v<Id>, "Id must be integral or an enum");
+    static_assert(unique_t<type_list<Ts...>>::size == sizeof...(Ts),
+                  "Types in a registry must be distinct");
+
+    using types = type_list<Ts...>;
+    using id_type = Id;
+
+    static constexpr std::size_t size = sizeof...(Ts);
+
+    // One past the last id
+    static constexpr Id count = static_cast<Id>(sizeof...(Ts));
+
+    static constexpr bool contains(Id id) {
+        return static_cast<std::size_t>(id) < sizeof...(Ts);
+    }
+
+    template <typename T>
+    struct type_to_id
+        : std::integral_constant<Id, static_cast<Id>(detail::tm_index_of<types, T>::value)> {
+        static_assert(detail::tm_index_of<types, T>::value < sizeof...(Ts),
+                      "Type is not in the registry");
+    };
+
+    template <Id I>
+    struct id_to_type {
+        static_assert(static_cast<std::size_t>(I) < sizeof...(Ts), "Id out of range");
+        using type = at_t<static_cast<std::size_t>(I), types>;
+    };
+};
+
+// Example: Define your types here; name is what type_id_from_name looks up
+struct TypeA {
+    static constexpr std::string_view name = "TypeA";
+};
+struct TypeB {
+    static constexpr std::string_view name = "TypeB";
+};
+struct TypeC {
+    static constexpr std::string_view name = "TypeC";
+};
 
 // Define the type list
 using MyTypeList = type_list<TypeA, TypeB, TypeC>;
 
-// Define an enum to hold the type ids
+// Type ids in MyTypeList order; the registry assigns the same values, and the
+// checks below keep the names in step with the list
 enum class TypeId : std::size_t {
     TypeA,
     TypeB,
@@ -25,17 +142,40 @@ enum class TypeId : std::size_t {
     Count // Optional: for the number of types
 };
 
+using MyTypeRegistry = type_registry<MyTypeList, TypeId>;
+
+static_assert(MyTypeRegistry::count == TypeId::Count, "TypeId must name every MyTypeList type");
+static_assert(MyTypeRegistry::type_to_id<TypeA>::value == TypeId::TypeA &&
+                  MyTypeRegistry::type_to_id<TypeB>::value == TypeId::TypeB &&
+                  MyTypeRegistry::type_to_id<TypeC>::value == TypeId::TypeC,
+              "TypeId enumerators must follow the MyTypeList order");
+
 // Mapping from type to enum value
 template <typename T>
-struct type_to_id;
+struct type_to_id : MyTypeRegistry::type_to_id<T> {};
+
+template <typename T>
+constexpr TypeId type_to_id_v = type_to_id<T>::value;
+
+// Mapping from enum value to type
+template <TypeId Id>
+struct id_to_type : MyTypeRegistry::id_to_type<Id> {};
+
+template <TypeId Id>
+using id_to_type_t = typename id_to_type<Id>::type;
 
-template <>
-struct type_to_id<TypeA> : std::integral_constant<TypeId, TypeId::TypeA> {};
+// A perfect_hash over T::name for the types of a list, so a name's
+// position is the type's position in the list
+template <typename... Ts>
+constexpr perfect_hash<sizeof...(Ts)> make_type_name_hash(type_list<Ts...>) {
+    return make_perfect_hash({std::string_view(Ts::name)...});
+}
 
-template <>
-struct type_to_id<TypeB> : std::integral_constant<TypeId, TypeId::TypeB> {};
+inline constexpr auto my_type_names = make_type_name_hash(MyTypeRegistry::types{});
 
-template <>
-struct type_to_id<TypeC> : std::integral_constant<TypeId, TypeId::TypeC> {};
+// Mapping from name to enum value; MyTypeRegistry::count if the name is unknown
+constexpr TypeId type_id_from_name(std::string_view name) {
+    return static_cast<TypeId>(my_type_names.find(name));
+}
 
-} // namespace tmpl_lib
\ No newline at end of file
+} // namespace tmpl_lib
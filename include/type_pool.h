@@ -0,0 +1,216 @@
+#ifndef TYPE_POOL_H
+#define TYPE_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "check_env.h"
+#include "type_dispatch.h"
+#include "type_map.h"
+
+/*
+ * Fixed-size slot pools, one per type.
+ *
+ * Each thread keeps a small array of free slots per type, so allocate and
+ * deallocate normally touch only thread-local memory. A thread whose cache
+ * runs dry takes the whole global freelist of that type with one atomic
+ * exchange; a thread whose cache overflows pushes half of it back as a
+ * single chain with one compare-and-swap. Only taking everything and
+ * pushing whole chains touch the global list, so it has no ABA problem.
+ * When both are empty a new slab of cache_capacity slots is allocated.
+ *
+ * Slabs are never returned to the system: memory freed on one thread is
+ * reused by any thread, and a thread's cache goes back to the global list
+ * when the thread exits.
+ */
+
+namespace tmpl_lib {
+
+namespace detail {
+
+struct tp_free_slot {
+    tp_free_slot* next;
+};
+
+constexpr std::size_t tp_max(std::size_t a, std::size_t b) { return a < b ? b : a; }
+
+constexpr std::size_t tp_round_up(std::size_t size, std::size_t align) {
+    return (size + align - 1) / align * align;
+}
+
+}  // namespace detail
+
+/**
+ * \brief Allocates uninitialized storage for single objects of type T.
+ */
+template <typename T>
+class slab_pool {
+public:
+    static constexpr std::size_t slot_align =
+        detail::tp_max(alignof(T), alignof(detail::tp_free_slot));
+    static constexpr std::size_t slot_size =
+        detail::tp_round_up(detail::tp_max(sizeof(T), sizeof(detail::tp_free_slot)), slot_align);
+    // Slots filling about half of a typical L1 data cache per slab, between
+    // 8 and 256 slots
+    static constexpr std::size_t slab_bytes = check_env::default_l1d_cache_size / 2;
+    static constexpr std::size_t slab_slots = slab_bytes / slot_size;
+    static constexpr std::size_t cache_capacity =
+        slab_slots < 8 ? 8 : slab_slots > 256 ? 256 : slab_slots;
+
+    static void* allocate() {
+        cache& local = local_cache();
+        if (local.count == 0) {
+            refill(local);
+        }
+        return local.slots[--local.count];
+    }
+
+    static void deallocate(void* p) noexcept {
+        cache& local = local_cache();
+        if (local.count == cache_capacity) {
+            local.count -= cache_capacity / 2;
+            push_chain(local.slots + local.count, cache_capacity / 2);
+        }
+        local.slots[local.count++] = p;
+    }
+
+private:
+    struct cache {
+        void* slots[cache_capacity];
+        std::size_t count = 0;
+        // Rest of a chain taken from the global list
+        detail::tp_free_slot* spare = nullptr;
+
+        ~cache() {
+            push_chain(slots, count);
+            if (spare != nullptr) {
+                detail::tp_free_slot* last = spare;
+                while (last->next != nullptr) {
+                    last = last->next;
+                }
+                push_chain(spare, last);
+            }
+        }
+    };
+
+    static cache& local_cache() {
+        static thread_local cache local;
+        return local;
+    }
+
+    // Links count slots and pushes them onto the global list in one step
+    static void push_chain(void* const* slots, std::size_t count) noexcept {
+        if (count == 0) {
+            return;
+        }
+        auto* first = static_cast<detail::tp_free_slot*>(slots[0]);
+        auto* last = first;
+        for (std::size_t i = 1; i < count; ++i) {
+            auto* slot = static_cast<detail::tp_free_slot*>(slots[i]);
+            last->next = slot;
+            last = slot;
+        }
+        push_chain(first, last);
+    }
+
+    static void push_chain(detail::tp_free_slot* first, detail::tp_free_slot* last) noexcept {
+        last->next = global_.load(std::memory_order_relaxed);
+        while (!global_.compare_exchange_weak(last->next, first, std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+        }
+    }
+
+    static void refill(cache& local) {
+        if (local.spare == nullptr) {
+            local.spare = global_.exchange(nullptr, std::memory_order_acquire);
+        }
+        while (local.spare != nullptr && local.count < cache_capacity) {
+            local.slots[local.count++] = local.spare;
+            local.spare = local.spare->next;
+        }
+        if (local.count > 0) {
+            return;
+        }
+        auto* slab = static_cast<unsigned char*>(::operator new(
+            cache_capacity * slot_size, std::align_val_t{slot_align}));
+        for (std::size_t i = cache_capacity; i-- > 0;) {
+            local.slots[local.count++] = slab + i * slot_size;
+        }
+    }
+
+    // On its own cache line, so that pools of different types do not contend
+    alignas(check_env::default_cache_line_size) static inline std::atomic<detail::tp_free_slot*>
+        global_{nullptr};
+};
+
+/**
+ * \brief slab_pool storage for the types of Registry, selected by runtime id.
+ *
+ * Every member throws std::out_of_range for an id Registry does not
+ * contain, as dispatch does; deallocate then leaves p untouched.
+ */
+template <typename Registry>
+struct type_pool {
+    using id_type = typename Registry::id_type;
+
+    static void* allocate(id_type id) {
+        return dispatch<Registry>(
+            id, [](auto tag) { return slab_pool<typename decltype(tag)::type>::allocate(); });
+    }
+
+    static void deallocate(id_type id, void* p) {
+        dispatch<Registry>(id, [p](auto tag) {
+            slab_pool<typename decltype(tag)::type>::deallocate(p);
+        });
+    }
+
+    static std::size_t slot_size(id_type id) {
+        return dispatch<Registry>(
+            id, [](auto tag) { return slab_pool<typename decltype(tag)::type>::slot_size; });
+    }
+};
+
+/**
+ * \brief Constructs a T in pooled storage.
+ */
+template <typename T, typename... Args>
+T* pool_new(Args&&... args) {
+    void* p = slab_pool<T>::allocate();
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+        return ::new (p) T(std::forward<Args>(args)...);
+    } else {
+        try {
+            return ::new (p) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slab_pool<T>::deallocate(p);
+            throw;
+        }
+    }
+}
+
+/**
+ * \brief Destroys an object created by pool_new.
+ */
+template <typename T>
+void pool_delete(T* p) noexcept {
+    if (p != nullptr) {
+        p->~T();
+        slab_pool<T>::deallocate(p);
+    }
+}
+
+/**
+ * \brief Storage for a MyTypeRegistry type named at runtime.
+ */
+inline void* pool_allocate(TypeId id) { return type_pool<MyTypeRegistry>::allocate(id); }
+
+inline void pool_deallocate(TypeId id, void* p) {
+    type_pool<MyTypeRegistry>::deallocate(id, p);
+}
+
+}  // namespace tmpl_lib
+
+#endif  // TYPE_POOL_H
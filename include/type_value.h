@@ -5,6 +5,54 @@
 #include <utility>
 #include <tuple>
 #include <array>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+// Stands in for allocator_type when the value type is not allocator-aware, so
+// that std::uses_allocator is false for such a TypeValue
+struct TypeValueNoAllocator {};
+
+template <typename T, typename = void>
+struct type_value_allocator {
+    using type = TypeValueNoAllocator;
+};
+
+template <typename T>
+struct type_value_allocator<T, std::void_t<typename T::allocator_type>> {
+    using type = typename T::allocator_type;
+};
+
+// The allocator_type of the first TypeValue that has one, for containers of
+// several TypeValues
+template <typename... TypeValues>
+struct type_values_allocator {
+    using type = TypeValueNoAllocator;
+};
+
+template <typename First, typename... Rest>
+struct type_values_allocator<First, Rest...> {
+    using type = std::conditional_t<std::is_same_v<typename First::allocator_type,
+                                                   TypeValueNoAllocator>,
+                                    typename type_values_allocator<Rest...>::type,
+                                    typename First::allocator_type>;
+};
+
+// C++17 stand-in for std::make_obj_using_allocator: builds a T following the
+// uses-allocator construction protocol (leading allocator_arg, trailing
+// allocator, or no allocator at all)
+template <typename T, typename Alloc, typename... Args>
+T make_using_allocator(const Alloc& alloc, Args&&... args) {
+    if constexpr (!std::uses_allocator_v<T, Alloc>) {
+        return T(std::forward<Args>(args)...);
+    } else if constexpr (std::is_constructible_v<T, std::allocator_arg_t, const Alloc&, Args...>) {
+        return T(std::allocator_arg, alloc, std::forward<Args>(args)...);
+    } else {
+        static_assert(std::is_constructible_v<T, Args..., const Alloc&>,
+                      "T uses the allocator but cannot be constructed with it");
+        return T(std::forward<Args>(args)..., alloc);
+    }
+}
 
 template <std::size_t I>
 struct IndexWrapper {
@@ -13,14 +61,121 @@ struct IndexWrapper {
         T value;
         static constexpr std::size_t index = I;
 
+        static constexpr auto output_indices = std::index_sequence<Os...>{};
+
+        using value_type = T;
+        using allocator_type = typename type_value_allocator<T>::type;
+
         explicit TypeValue(const T& val)
             : value(val) {}
 
         explicit TypeValue(T&& val)
             : value(std::move(val)) {}
+
+        // Constructs the value in place from args
+        template <typename... Args>
+        explicit TypeValue(std::in_place_t, Args&&... args)
+            : value(std::forward<Args>(args)...) {}
+
+        // Constructs the value in place from a tuple of arguments
+        template <typename... Args>
+        TypeValue(std::piecewise_construct_t, std::tuple<Args...> args)
+            : value(std::make_from_tuple<T>(std::move(args))) {}
+
+        // Uses-allocator construction
+        template <typename Alloc, typename... Args>
+        TypeValue(std::allocator_arg_t, const Alloc& alloc, Args&&... args)
+            : value(::make_using_allocator<T>(alloc, std::forward<Args>(args)...)) {}
+
+        template <typename Alloc, typename... Args>
+        TypeValue(std::allocator_arg_t, const Alloc& alloc, std::in_place_t, Args&&... args)
+            : value(::make_using_allocator<T>(alloc, std::forward<Args>(args)...)) {}
+
+        template <typename Alloc>
+        TypeValue(std::allocator_arg_t, const Alloc& alloc, const TypeValue& other)
+            : value(::make_using_allocator<T>(alloc, other.value)) {}
+
+        template <typename Alloc>
+        TypeValue(std::allocator_arg_t, const Alloc& alloc, TypeValue&& other)
+            : value(::make_using_allocator<T>(alloc, std::move(other.value))) {}
+
+        template <typename Alloc, typename... Args>
+        TypeValue(std::allocator_arg_t, const Alloc& alloc, std::piecewise_construct_t,
+                  std::tuple<Args...> args)
+            : value(std::apply(
+                  [&alloc](auto&&... xs) {
+                      return ::make_using_allocator<T>(alloc,
+                                                       std::forward<decltype(xs)>(xs)...);
+                  },
+                  std::move(args))) {}
     };
 };
 
+// Memory layout of the TypeValue bases of a TypeValueContainer
+enum class TypeValueLayout {
+    declaration_order,  // bases are laid out in the order they are listed
+    packed              // bases are sorted by alignment, then size, to minimize padding
+};
+
+// Inherits from the given TypeValues in the listed order; the order of the
+// bases fixes the object layout
+template <typename... TypeValues>
+struct TypeValueBases : public TypeValues... {
+    explicit TypeValueBases(TypeValues&&... vals)
+        : TypeValues(std::forward<TypeValues>(vals))... {}
+
+    // Each base is built in place from its own tuple of arguments
+    template <typename... Tuples>
+    TypeValueBases(std::piecewise_construct_t, Tuples&&... args)
+        : TypeValues(std::piecewise_construct, std::forward<Tuples>(args))... {}
+
+    template <typename Alloc>
+    TypeValueBases(std::allocator_arg_t, const Alloc& alloc, TypeValues&&... vals)
+        : TypeValues(std::allocator_arg, alloc, std::forward<TypeValues>(vals))... {}
+
+    template <typename Alloc, typename... Tuples>
+    TypeValueBases(std::allocator_arg_t, const Alloc& alloc, std::piecewise_construct_t,
+                   Tuples&&... args)
+        : TypeValues(std::allocator_arg, alloc, std::piecewise_construct,
+                     std::forward<Tuples>(args))... {}
+};
+
+template <TypeValueLayout Layout, typename... TypeValues>
+struct TypeValueLayoutOrder {
+    // Compile-time permutation: storage position -> declaration index
+    static constexpr std::array<std::size_t, sizeof...(TypeValues)> make_order() {
+        std::array<std::size_t, sizeof...(TypeValues)> order{};
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        if constexpr (Layout == TypeValueLayout::packed && sizeof...(TypeValues) > 1) {
+            constexpr std::size_t aligns[] = {alignof(TypeValues)...};
+            constexpr std::size_t sizes[] = {sizeof(TypeValues)...};
+            // Stable insertion sort: larger alignment first, then larger size
+            for (std::size_t i = 1; i < order.size(); ++i) {
+                std::size_t cur = order[i];
+                std::size_t j = i;
+                while (j > 0 && (aligns[order[j - 1]] < aligns[cur] ||
+                                 (aligns[order[j - 1]] == aligns[cur] &&
+                                  sizes[order[j - 1]] < sizes[cur]))) {
+                    order[j] = order[j - 1];
+                    --j;
+                }
+                order[j] = cur;
+            }
+        }
+        return order;
+    }
+
+    static constexpr std::array<std::size_t, sizeof...(TypeValues)> order = make_order();
+
+    template <std::size_t... Ps>
+    static auto make_bases(std::index_sequence<Ps...>)
+        -> TypeValueBases<std::tuple_element_t<order[Ps], std::tuple<TypeValues...>>...>;
+
+    using bases_type = decltype(make_bases(std::make_index_sequence<sizeof...(TypeValues)>{}));
+};
+
 // Using nested structure approach for TypeValueContainer
 template <std::size_t ...Os>
 struct OutputIndicesWrapper {
@@ -28,29 +183,83 @@ struct OutputIndicesWrapper {
     template <std::size_t Index>
     static constexpr std::size_t get_value_at() {
         static_assert(Index < sizeof...(Os), "Index out of range");
-        constexpr std::array<std::size_t, sizeof...(Os)> values = {Os...};
         return values[Index];
     }
 
+    static constexpr std::array<std::size_t, sizeof...(Os)> values = {Os...};
+
+    // Value at a runtime index; throws std::out_of_range past the last one
+    static constexpr std::size_t value_at(std::size_t i) {
+        if (i >= sizeof...(Os)) {
+            throw std::out_of_range("value_at: output index out of range");
+        }
+        return values[i];
+    }
+
     // Get the size of the parameter pack
     static constexpr std::size_t size() {
         return sizeof...(Os);
     }
 
-    template <typename... TypeValues>
-    struct TypeValueContainer : public TypeValues... {
-        
-        explicit TypeValueContainer(TypeValues&&... vals)
-            : TypeValues(std::forward<TypeValues>(vals))... {}
+    template <TypeValueLayout Layout, typename... TypeValues>
+    struct BasicTypeValueContainer
+        : public TypeValueLayoutOrder<Layout, TypeValues...>::bases_type {
+        using layout_order = TypeValueLayoutOrder<Layout, TypeValues...>;
+        using bases_type = typename layout_order::bases_type;
+        using allocator_type = typename type_values_allocator<TypeValues...>::type;
+
+        explicit BasicTypeValueContainer(TypeValues&&... vals)
+            : BasicTypeValueContainer(std::make_index_sequence<sizeof...(TypeValues)>{},
+                                      std::forward_as_tuple(std::forward<TypeValues>(vals)...)) {}
+
+        // Piecewise construction: one tuple of constructor arguments per TypeValue,
+        // so no temporaries have to be built and moved in
+        template <typename... Tuples,
+                  typename = std::enable_if_t<sizeof...(Tuples) == sizeof...(TypeValues)>>
+        BasicTypeValueContainer(std::piecewise_construct_t, Tuples&&... args)
+            : BasicTypeValueContainer(std::make_index_sequence<sizeof...(TypeValues)>{},
+                                      std::forward_as_tuple(std::forward<Tuples>(args)...),
+                                      std::piecewise_construct) {}
+
+        // Uses-allocator construction of every member, e.g. with a
+        // std::pmr::polymorphic_allocator over a monotonic arena
+        template <typename Alloc>
+        BasicTypeValueContainer(std::allocator_arg_t, const Alloc& alloc, TypeValues&&... vals)
+            : BasicTypeValueContainer(std::make_index_sequence<sizeof...(TypeValues)>{},
+                                      std::forward_as_tuple(std::forward<TypeValues>(vals)...),
+                                      std::allocator_arg, alloc) {}
+
+        template <typename Alloc, typename... Tuples,
+                  typename = std::enable_if_t<sizeof...(Tuples) == sizeof...(TypeValues)>>
+        BasicTypeValueContainer(std::allocator_arg_t, const Alloc& alloc,
+                                std::piecewise_construct_t, Tuples&&... args)
+            : BasicTypeValueContainer(std::make_index_sequence<sizeof...(TypeValues)>{},
+                                      std::forward_as_tuple(std::forward<Tuples>(args)...),
+                                      std::allocator_arg, alloc, std::piecewise_construct) {}
+
+        // Allocator-extended copy and move, used by allocator-aware containers
+        // such as std::pmr::vector when they copy or relocate elements
+        template <typename Alloc>
+        BasicTypeValueContainer(std::allocator_arg_t, const Alloc& alloc,
+                                const BasicTypeValueContainer& other)
+            : BasicTypeValueContainer(std::allocator_arg, alloc, other,
+                                      std::make_index_sequence<sizeof...(TypeValues)>{}) {}
+
+        template <typename Alloc>
+        BasicTypeValueContainer(std::allocator_arg_t, const Alloc& alloc,
+                                BasicTypeValueContainer&& other)
+            : BasicTypeValueContainer(std::allocator_arg, alloc, std::move(other),
+                                      std::make_index_sequence<sizeof...(TypeValues)>{}) {}
 
         template <std::size_t Index>
         auto& get() {
-            return std::get<Index>(std::forward_as_tuple(static_cast<TypeValues&>(*this)...));
+            return static_cast<std::tuple_element_t<Index, std::tuple<TypeValues...>>&>(*this);
         }
 
         template <std::size_t Index>
         const auto& get() const {
-            return std::get<Index>(std::forward_as_tuple(static_cast<const TypeValues&>(*this)...));
+            return static_cast<const std::tuple_element_t<Index, std::tuple<TypeValues...>>&>(
+                *this);
         }
 
         // Access to the output indices
@@ -62,11 +271,247 @@ struct OutputIndicesWrapper {
             return OutputIndicesWrapper::template get_value_at<Index>();
         }
         
+        // Output index at a runtime position; throws std::out_of_range past
+        // the last one
+        static constexpr std::size_t output_index_at(std::size_t i) {
+            return OutputIndicesWrapper::value_at(i);
+        }
+
         // Get the size of the output indices
         static constexpr std::size_t output_size() {
             return OutputIndicesWrapper::size();
         }
+
+        // Get the number of TypeValue members
+        static constexpr std::size_t value_count() {
+            return sizeof...(TypeValues);
+        }
+
+        static constexpr TypeValueLayout layout = Layout;
+
+        // Storage position -> declaration index of each TypeValue base
+        static constexpr auto storage_order = layout_order::order;
+
+        // Size of the bases laid out in declaration order vs. the chosen layout
+        static constexpr std::size_t declaration_order_size = sizeof(TypeValueBases<TypeValues...>);
+        static constexpr std::size_t storage_size = sizeof(bases_type);
+        static constexpr std::size_t bytes_saved =
+            declaration_order_size > storage_size ? declaration_order_size - storage_size : 0;
+
+    private:
+        // Hands the per-member arguments to the bases in storage order
+        template <std::size_t... Ps, typename Args, typename... Prefix>
+        BasicTypeValueContainer(std::index_sequence<Ps...>, Args&& args, Prefix&&... prefix)
+            : bases_type(std::forward<Prefix>(prefix)...,
+                         std::get<layout_order::order[Ps]>(std::move(args))...) {}
+
+        template <std::size_t Index>
+        using member_value_t =
+            typename std::tuple_element_t<Index, std::tuple<TypeValues...>>::value_type;
+
+        // Rebuilds every member of other with alloc, moving them when other is
+        // an rvalue
+        template <typename Alloc, typename Other, std::size_t... Is>
+        BasicTypeValueContainer(std::allocator_arg_t, const Alloc& alloc, Other&& other,
+                                std::index_sequence<Is...>)
+            : BasicTypeValueContainer(
+                  std::allocator_arg, alloc, std::piecewise_construct,
+                  std::forward_as_tuple(
+                      static_cast<std::conditional_t<std::is_lvalue_reference_v<Other>,
+                                                     const member_value_t<Is>&,
+                                                     member_value_t<Is>&&>>(
+                          other.template get<Is>().value))...) {}
     };
+
+    template <typename... TypeValues>
+    using TypeValueContainer =
+        BasicTypeValueContainer<TypeValueLayout::declaration_order, TypeValues...>;
+
+    // Same interface as TypeValueContainer, but the bases are reordered to
+    // minimize padding; get<Index>() still follows the declaration order
+    template <typename... TypeValues>
+    using PackedTypeValueContainer =
+        BasicTypeValueContainer<TypeValueLayout::packed, TypeValues...>;
+};
+
+template <typename C, typename = void>
+struct is_type_value_container : std::false_type {};
+
+template <typename C>
+struct is_type_value_container<
+    C, std::void_t<typename C::layout_order, decltype(C::output_indices)>> : std::true_type {};
+
+template <typename C>
+constexpr bool is_type_value_container_v = is_type_value_container<C>::value;
+
+// Calls f(value, index, output_indices) when f accepts it, f(value) otherwise;
+// index is a std::integral_constant holding TypeValue::index
+template <typename F, typename TV>
+decltype(auto) invoke_type_value(F& f, TV& tv) {
+    using type_value = std::remove_const_t<TV>;
+    using index_constant = std::integral_constant<std::size_t, type_value::index>;
+    if constexpr (std::is_invocable_v<F&, decltype((tv.value)), index_constant,
+                                      decltype(type_value::output_indices)>) {
+        return f(tv.value, index_constant{}, type_value::output_indices);
+    } else {
+        return f(tv.value);
+    }
+}
+
+template <typename Container, typename F, std::size_t... Is>
+void for_each_impl(Container& container, F& f, std::index_sequence<Is...>) {
+    (invoke_type_value(f, container.template get<Is>()), ...);
+}
+
+template <typename Container, typename F, std::size_t... Is>
+void transform_impl(Container& container, F& f, std::index_sequence<Is...>) {
+    ((container.template get<Is>().value = invoke_type_value(f, container.template get<Is>())),
+     ...);
+}
+
+template <typename T, typename Op, typename TV>
+void reduce_step(T& acc, Op& op, TV& tv) {
+    using type_value = std::remove_const_t<TV>;
+    using index_constant = std::integral_constant<std::size_t, type_value::index>;
+    if constexpr (std::is_invocable_v<Op&, T, decltype((tv.value)), index_constant,
+                                      decltype(type_value::output_indices)>) {
+        acc = op(std::move(acc), tv.value, index_constant{}, type_value::output_indices);
+    } else {
+        acc = op(std::move(acc), tv.value);
+    }
+}
+
+template <typename Container, typename T, typename Op, std::size_t... Is>
+T reduce_impl(Container& container, T init, Op& op, std::index_sequence<Is...>) {
+    (reduce_step(init, op, container.template get<Is>()), ...);
+    return init;
+}
+
+/**
+ * \brief Calls f on every member value of a TypeValueContainer, in declaration order.
+ *
+ * Expands to one call per member (no recursion, no type erasure). f may take
+ * just the value, or (value, index, output_indices) to also receive the
+ * member's compile-time TypeValue::index and output indices.
+ */
+template <typename Container, typename F,
+          typename = std::enable_if_t<is_type_value_container_v<std::remove_const_t<Container>>>>
+void for_each(Container& container, F&& f) {
+    for_each_impl(container, f, std::make_index_sequence<Container::value_count()>{});
+}
+
+/**
+ * \brief Replaces every member value with the result of f applied to it.
+ *
+ * f is called like in for_each and must return something assignable to each value.
+ */
+template <typename Container, typename F,
+          typename = std::enable_if_t<is_type_value_container_v<Container>>>
+void transform(Container& container, F&& f) {
+    transform_impl(container, f, std::make_index_sequence<Container::value_count()>{});
+}
+
+/**
+ * \brief Left fold of op over the member values: op(op(init, v0), v1)...
+ *
+ * op takes the accumulator followed by what for_each would pass to a visitor.
+ */
+template <typename Container, typename T, typename Op,
+          typename = std::enable_if_t<is_type_value_container_v<std::remove_const_t<Container>>>>
+T reduce(Container& container, T init, Op&& op) {
+    return reduce_impl(container, std::move(init), op,
+                       std::make_index_sequence<Container::value_count()>{});
+}
+
+template <std::size_t I, typename R, typename Container, typename F>
+R visit_member(Container& container, F& f) {
+    return static_cast<R>(invoke_type_value(f, container.template get<I>()));
+}
+
+template <typename R, typename Container, typename F, typename Indices>
+struct visit_table;
+
+template <typename R, typename Container, typename F, std::size_t... Is>
+struct visit_table<R, Container, F, std::index_sequence<Is...>> {
+    static constexpr R (*entries[])(Container&, F&) = {&visit_member<Is, R, Container, F>...};
 };
 
+/**
+ * \brief Calls f on the member value at runtime index i (declaration order).
+ *
+ * f is called like in for_each, through a table of one function pointer per
+ * member, so the call costs one indirect branch however many members there
+ * are. The result is that of f for member 0; the other calls must return
+ * something convertible to it. Throws std::out_of_range if i is not below
+ * value_count().
+ */
+template <typename Container, typename F,
+          typename = std::enable_if_t<is_type_value_container_v<std::remove_const_t<Container>>>>
+decltype(auto) visit_at(Container& container, std::size_t i, F&& f) {
+    constexpr std::size_t count = Container::value_count();
+    static_assert(count > 0, "visit_at requires at least one member");
+    using result = decltype(invoke_type_value(f, container.template get<0>()));
+    if (i >= count) {
+        throw std::out_of_range("visit_at: member index out of range");
+    }
+    return visit_table<result, Container, std::remove_reference_t<F>,
+                       std::make_index_sequence<count>>::entries[i](container, f);
+}
+
+template <typename Container, std::size_t Index>
+using container_value_t =
+    typename std::decay_t<decltype(std::declval<Container&>().template get<Index>())>::value_type;
+
+template <typename Container, std::size_t... Is>
+constexpr bool is_homogeneous_impl(std::index_sequence<Is...>) {
+    return (std::is_same_v<container_value_t<Container, 0>, container_value_t<Container, Is>> &&
+            ...);
+}
+
+template <typename Container, std::size_t... Is>
+auto load_values_impl(const Container& container, std::index_sequence<Is...>) {
+    return std::array<container_value_t<Container, 0>, sizeof...(Is)>{
+        container.template get<Is>().value...};
+}
+
+template <typename Container, typename T, std::size_t N, std::size_t... Is>
+void store_values_impl(Container& container, std::array<T, N>&& values,
+                       std::index_sequence<Is...>) {
+    ((container.template get<Is>().value = std::move(values[Is])), ...);
+}
+
+/**
+ * \brief Copies the values of a homogeneous container (e.g. all double) into
+ * a std::array in declaration order, so loops over them can be vectorized.
+ *
+ * The members are separate base subobjects, so they cannot be viewed in
+ * place as one array; load_values and store_values move them in and out of
+ * one, which for trivially copyable values compiles to plain loads and
+ * stores.
+ */
+template <typename Container,
+          typename = std::enable_if_t<is_type_value_container_v<Container>>>
+auto load_values(const Container& container) {
+    constexpr std::size_t count = Container::value_count();
+    static_assert(count > 0, "load_values requires at least one member");
+    static_assert(is_homogeneous_impl<Container>(std::make_index_sequence<count>{}),
+                  "load_values requires all members to have the same value type");
+    return load_values_impl(container, std::make_index_sequence<count>{});
+}
+
+/**
+ * \brief Assigns values[i] to member i of a homogeneous container; the
+ * inverse of load_values.
+ */
+template <typename Container, typename T, std::size_t N,
+          typename = std::enable_if_t<is_type_value_container_v<Container>>>
+void store_values(Container& container, std::array<T, N> values) {
+    constexpr std::size_t count = Container::value_count();
+    static_assert(N == count, "store_values requires one value per member");
+    static_assert(is_homogeneous_impl<Container>(std::make_index_sequence<count>{}) &&
+                      std::is_same_v<T, container_value_t<Container, 0>>,
+                  "store_values requires all members to have the value type T");
+    store_values_impl(container, std::move(values), std::make_index_sequence<count>{});
+}
+
 #endif // TYPE_VALUE_H
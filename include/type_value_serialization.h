@@ -0,0 +1,261 @@
+#ifndef TYPE_VALUE_SERIALIZATION_H
+#define TYPE_VALUE_SERIALIZATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "type_value.h"
+
+/*
+ * Binary image of a TypeValueContainer (host byte order):
+ *
+ *   u64 fingerprint                      schema hash, see type_value_fingerprint
+ *   all values trivially copyable:
+ *     value_0 .. value_N-1               sizeof(value) bytes each, no padding
+ *   otherwise, for every member:
+ *     u64 length, length bytes           encoded by type_value_codec
+ *
+ * Members are always written in declaration order, so the image does not
+ * depend on the container layout.
+ */
+
+// Encodes a single TypeValue::value. Specialize for types that are neither
+// trivially copyable nor one of the contiguous containers handled below.
+template <typename T, typename = void>
+struct type_value_codec;
+
+template <typename T>
+struct type_value_codec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+    static std::size_t size(const T&) { return sizeof(T); }
+
+    static void encode(const T& value, std::uint8_t* out) { std::memcpy(out, &value, sizeof(T)); }
+
+    static bool decode(T& value, const std::uint8_t* in, std::size_t length) {
+        if (length != sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, in, sizeof(T));
+        return true;
+    }
+};
+
+template <typename Ch, typename Traits, typename Alloc>
+struct type_value_codec<std::basic_string<Ch, Traits, Alloc>,
+                        std::enable_if_t<std::is_trivially_copyable_v<Ch>>> {
+    using string_type = std::basic_string<Ch, Traits, Alloc>;
+
+    static std::size_t size(const string_type& value) { return value.size() * sizeof(Ch); }
+
+    static void encode(const string_type& value, std::uint8_t* out) {
+        if (!value.empty()) {
+            std::memcpy(out, value.data(), value.size() * sizeof(Ch));
+        }
+    }
+
+    static bool decode(string_type& value, const std::uint8_t* in, std::size_t length) {
+        if (length % sizeof(Ch) != 0) {
+            return false;
+        }
+        value.resize(length / sizeof(Ch));
+        if (length != 0) {
+            std::memcpy(&value[0], in, length);
+        }
+        return true;
+    }
+};
+
+template <typename T, typename Alloc>
+struct type_value_codec<std::vector<T, Alloc>, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+    using vector_type = std::vector<T, Alloc>;
+
+    static std::size_t size(const vector_type& value) { return value.size() * sizeof(T); }
+
+    static void encode(const vector_type& value, std::uint8_t* out) {
+        if (!value.empty()) {
+            std::memcpy(out, value.data(), value.size() * sizeof(T));
+        }
+    }
+
+    static bool decode(vector_type& value, const std::uint8_t* in, std::size_t length) {
+        if (length % sizeof(T) != 0) {
+            return false;
+        }
+        value.resize(length / sizeof(T));
+        if (length != 0) {
+            std::memcpy(value.data(), in, length);
+        }
+        return true;
+    }
+};
+
+template <typename Container, std::size_t... Is>
+constexpr bool type_value_all_trivially_copyable(std::index_sequence<Is...>) {
+    return (std::is_trivially_copyable_v<container_value_t<Container, Is>> && ...);
+}
+
+template <typename Container, std::size_t... Is>
+constexpr std::size_t type_value_packed_size(std::index_sequence<Is...>) {
+    return (std::size_t{0} + ... + sizeof(container_value_t<Container, Is>));
+}
+
+constexpr std::uint64_t type_value_fnv1a(std::uint64_t hash, std::uint64_t value) {
+    for (int byte = 0; byte < 8; ++byte) {
+        hash ^= (value >> (byte * 8)) & 0xff;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template <typename Container, std::size_t... Os, std::size_t... Is>
+constexpr std::uint64_t type_value_fingerprint_impl(std::index_sequence<Os...>,
+                                                    std::index_sequence<Is...>) {
+    std::uint64_t hash = 14695981039346656037ull;
+    hash = type_value_fnv1a(hash, sizeof...(Os));
+    ((hash = type_value_fnv1a(hash, Os)), ...);
+    hash = type_value_fnv1a(hash, sizeof...(Is));
+    ((hash = type_value_fnv1a(
+          hash, std::decay_t<decltype(std::declval<Container&>().template get<Is>())>::index),
+      hash = type_value_fnv1a(hash, sizeof(container_value_t<Container, Is>)),
+      hash = type_value_fnv1a(hash,
+                              std::is_trivially_copyable_v<container_value_t<Container, Is>>)),
+     ...);
+    return hash;
+}
+
+/**
+ * \brief Schema fingerprint of a TypeValueContainer.
+ *
+ * Hash of the output indices and of every member's index, value size and
+ * trivially-copyable flag; deserialize rejects images with a different one.
+ */
+template <typename Container>
+constexpr std::uint64_t type_value_fingerprint = type_value_fingerprint_impl<Container>(
+    Container::output_indices, std::make_index_sequence<Container::value_count()>{});
+
+template <typename Container>
+constexpr bool type_value_trivially_serializable = type_value_all_trivially_copyable<Container>(
+    std::make_index_sequence<Container::value_count()>{});
+
+template <typename Container, std::size_t... Is>
+void serialize_impl(const Container& container, std::vector<std::uint8_t>& out,
+                    std::index_sequence<Is...>) {
+    constexpr std::uint64_t fingerprint = type_value_fingerprint<Container>;
+    std::size_t pos = out.size();
+
+    if constexpr (type_value_trivially_serializable<Container>) {
+        // Fixed-size image: one resize, then constant-size copies the
+        // compiler merges into straight-line stores
+        constexpr std::size_t image_size =
+            type_value_packed_size<Container>(std::index_sequence<Is...>{});
+        out.resize(pos + sizeof(fingerprint) + image_size);
+        std::uint8_t* dst = out.data() + pos;
+        std::memcpy(dst, &fingerprint, sizeof(fingerprint));
+        dst += sizeof(fingerprint);
+        ((std::memcpy(dst, &container.template get<Is>().value,
+                      sizeof(container_value_t<Container, Is>)),
+          dst += sizeof(container_value_t<Container, Is>)),
+         ...);
+    } else {
+        const std::size_t lengths[] = {
+            type_value_codec<container_value_t<Container, Is>>::size(
+                container.template get<Is>().value)...};
+        std::size_t total = sizeof(fingerprint);
+        for (std::size_t length : lengths) {
+            total += sizeof(std::uint64_t) + length;
+        }
+        out.resize(pos + total);
+        std::uint8_t* dst = out.data() + pos;
+        std::memcpy(dst, &fingerprint, sizeof(fingerprint));
+        dst += sizeof(fingerprint);
+        auto write_member = [&dst](const auto& value, std::uint64_t length) {
+            using value_type = std::decay_t<decltype(value)>;
+            std::memcpy(dst, &length, sizeof(length));
+            dst += sizeof(length);
+            type_value_codec<value_type>::encode(value, dst);
+            dst += length;
+        };
+        (write_member(container.template get<Is>().value, lengths[Is]), ...);
+    }
+}
+
+template <typename Container, std::size_t... Is>
+std::size_t deserialize_impl(const std::uint8_t* data, std::size_t size, Container& container,
+                             std::index_sequence<Is...>) {
+    constexpr std::uint64_t fingerprint = type_value_fingerprint<Container>;
+    std::uint64_t stored = 0;
+    if (size < sizeof(stored)) {
+        return 0;
+    }
+    std::memcpy(&stored, data, sizeof(stored));
+    if (stored != fingerprint) {
+        return 0;
+    }
+    std::size_t pos = sizeof(stored);
+
+    if constexpr (type_value_trivially_serializable<Container>) {
+        constexpr std::size_t image_size =
+            type_value_packed_size<Container>(std::index_sequence<Is...>{});
+        if (size - pos < image_size) {
+            return 0;
+        }
+        const std::uint8_t* src = data + pos;
+        ((std::memcpy(&container.template get<Is>().value, src,
+                      sizeof(container_value_t<Container, Is>)),
+          src += sizeof(container_value_t<Container, Is>)),
+         ...);
+        return pos + image_size;
+    } else {
+        auto read_member = [&](auto& value) {
+            using value_type = std::decay_t<decltype(value)>;
+            std::uint64_t length = 0;
+            if (size - pos < sizeof(length)) {
+                return false;
+            }
+            std::memcpy(&length, data + pos, sizeof(length));
+            pos += sizeof(length);
+            if (size - pos < length ||
+                !type_value_codec<value_type>::decode(value, data + pos,
+                                                      static_cast<std::size_t>(length))) {
+                return false;
+            }
+            pos += static_cast<std::size_t>(length);
+            return true;
+        };
+        return (read_member(container.template get<Is>().value) && ...) ? pos : 0;
+    }
+}
+
+/**
+ * \brief Appends the binary image of a TypeValueContainer to out.
+ *
+ * \param container The container to write.
+ * \param out The buffer the image is appended to.
+ */
+template <typename Container,
+          typename = std::enable_if_t<is_type_value_container_v<Container>>>
+void serialize(const Container& container, std::vector<std::uint8_t>& out) {
+    serialize_impl(container, out, std::make_index_sequence<Container::value_count()>{});
+}
+
+/**
+ * \brief Reads a binary image written by serialize back into a container.
+ *
+ * \param data The image.
+ * \param size The number of bytes available at data.
+ * \param container The container whose values are overwritten.
+ * \return The number of bytes consumed, or 0 if the fingerprint does not
+ * match or the image is truncated or malformed.
+ */
+template <typename Container,
+          typename = std::enable_if_t<is_type_value_container_v<Container>>>
+std::size_t deserialize(const std::uint8_t* data, std::size_t size, Container& container) {
+    return deserialize_impl(data, size, container,
+                            std::make_index_sequence<Container::value_count()>{});
+}
+
+#endif // TYPE_VALUE_SERIALIZATION_H
@@ -0,0 +1,643 @@
+#ifndef VECTOR_COMPARATOR_H
+#define VECTOR_COMPARATOR_H
+
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <sstream>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "binary_delta.h"
+#include "block_diff.h"
+#include "byte_compare.h"
+#include "field_diff.h"
+#include "hex_writer.h"
+#include "thread_pool.h"
+
+// ANSI color codes for terminal output
+namespace Colors {
+    const std::string RESET = "\033[0m";
+    const std::string RED = "\033[31m";
+    const std::string GREEN = "\033[32m";
+    const std::string YELLOW = "\033[33m";
+    const std::string BLUE = "\033[34m";
+    const std::string MAGENTA = "\033[35m";
+    const std::string CYAN = "\033[36m";
+    const std::string WHITE = "\033[37m";
+    const std::string BOLD = "\033[1m";
+    const std::string BG_RED = "\033[41m";
+    const std::string BG_GREEN = "\033[42m";
+    const std::string BG_YELLOW = "\033[43m";
+}
+
+class VectorComparator {
+public:
+    struct Difference {
+        std::size_t position;
+        uint8_t value1;
+        uint8_t value2;
+        
+        Difference(std::size_t pos, uint8_t v1, uint8_t v2) 
+            : position(pos), value1(v1), value2(v2) {}
+    };
+    
+    // A run of differing bytes. Bytes past the end of the shorter region
+    // count as differing.
+    using DiffRange = mismatch_range;
+    
+    // The functions below that take a thread_pool scan on the calling thread
+    // when it is null, and split large inputs into chunks compared on the
+    // pool otherwise; the results are the same either way.
+    
+    // Calls f(DiffRange) for every run of differences, in order, without
+    // allocating (with a pool, only the runs of one round of chunks are held)
+    template <typename F>
+    static void for_each_difference_range(const uint8_t* vec1, std::size_t len1,
+                                          const uint8_t* vec2, std::size_t len2, F&& f,
+                                          thread_pool* pool = nullptr) {
+        std::size_t common_size = std::min(len1, len2);
+        std::size_t max_size = std::max(len1, len2);
+        
+        // Held back one run so that a run reaching the end of the common
+        // part merges with the size difference
+        DiffRange pending{0, 0};
+        auto hold = [&](DiffRange range) {
+            if (pending.length != 0) {
+                f(pending);
+            }
+            pending = range;
+        };
+        if (pool != nullptr) {
+            parallel_for_each_mismatch_range(vec1, vec2, common_size, hold, *pool);
+        } else {
+            for_each_mismatch_range(vec1, vec2, common_size, hold);
+        }
+        if (max_size > common_size) {
+            if (pending.length != 0 && pending.end() == common_size) {
+                pending.length += max_size - common_size;
+            } else {
+                if (pending.length != 0) {
+                    f(pending);
+                }
+                pending = {common_size, max_size - common_size};
+            }
+        }
+        if (pending.length != 0) {
+            f(pending);
+        }
+    }
+    
+    // Calls f(position, value1, value2) for every differing byte, in order,
+    // without allocating; missing bytes read as 0
+    template <typename F>
+    static void for_each_difference(const uint8_t* vec1, std::size_t len1,
+                                    const uint8_t* vec2, std::size_t len2, F&& f,
+                                    thread_pool* pool = nullptr) {
+        for_each_difference_range(vec1, len1, vec2, len2, [&](DiffRange range) {
+            for (std::size_t i = range.offset; i < range.end(); ++i) {
+                f(i, (i < len1) ? vec1[i] : uint8_t(0), (i < len2) ? vec2[i] : uint8_t(0));
+            }
+        }, pool);
+    }
+    
+    // Compare two memory regions and return the runs of differences; the
+    // result grows with the number of runs, not of differing bytes
+    static std::vector<DiffRange> compare_ranges(const uint8_t* vec1, std::size_t len1,
+                                                 const uint8_t* vec2, std::size_t len2,
+                                                 thread_pool* pool = nullptr) {
+        std::vector<DiffRange> ranges;
+        for_each_difference_range(vec1, len1, vec2, len2,
+                                  [&](DiffRange range) { ranges.push_back(range); }, pool);
+        return ranges;
+    }
+    
+    // Number of differing bytes, counted from the compare masks without
+    // materializing anything
+    static std::size_t count_differences(const uint8_t* vec1, std::size_t len1,
+                                         const uint8_t* vec2, std::size_t len2,
+                                         thread_pool* pool = nullptr) {
+        std::size_t common_size = std::min(len1, len2);
+        std::size_t common_differences = pool != nullptr
+            ? parallel_count_mismatches(vec1, vec2, common_size, *pool)
+            : count_mismatches(vec1, vec2, common_size);
+        return common_differences + std::max(len1, len2) - common_size;
+    }
+    
+    // Compare two memory regions and return all differences, one entry per
+    // differing byte; prefer compare_ranges for large inputs
+    static std::vector<Difference> compare(const uint8_t* vec1, std::size_t len1,
+                                         const uint8_t* vec2, std::size_t len2) {
+        std::vector<Difference> differences;
+        
+        std::size_t max_size = std::max(len1, len2);
+        std::size_t common_size = std::min(len1, len2);
+        
+        // Equal 64-byte blocks are skipped with vector compares; only the
+        // blocks that differ are looked at byte by byte
+        for_each_mismatch(vec1, vec2, common_size, [&](std::size_t i) {
+            differences.emplace_back(i, vec1[i], vec2[i]);
+        });
+        
+        // Every byte past the shorter region is a difference
+        for (std::size_t i = common_size; i < max_size; ++i) {
+            uint8_t v1 = (i < len1) ? vec1[i] : 0;
+            uint8_t v2 = (i < len2) ? vec2[i] : 0;
+            differences.emplace_back(i, v1, v2);
+        }
+        
+        return differences;
+    }
+    
+    // Lines shown by default: all of them
+    static constexpr std::size_t all_lines = static_cast<std::size_t>(-1);
+    
+    // Print side-by-side comparison with color highlighting. With
+    // context_lines, only the lines within that many lines of a difference
+    // are printed and each skipped stretch becomes one elision line, so the
+    // cost follows the differences rather than the input size.
+    static void print_comparison(const uint8_t* vec1, std::size_t len1,
+                               const uint8_t* vec2, std::size_t len2,
+                               std::size_t bytes_per_line = 32,
+                               std::ostream* output = nullptr,
+                               std::size_t context_lines = all_lines) {
+        HexWriter out(output ? *output : std::cout);
+        
+        print_comparison_header(out);
+        print_windows(vec1, len1, vec2, len2, bytes_per_line, context_lines, out,
+                      [&](const uint8_t* v1, std::size_t l1, const uint8_t* v2, std::size_t l2,
+                          std::size_t base) {
+                          print_comparison_rows(v1, l1, v2, l2, bytes_per_line, out, base);
+                      });
+        print_legend(out);
+    }
+    
+    // Print interleaved comparison (vec1 and vec2 on adjacent lines); see
+    // print_comparison for context_lines
+    static void print_interleaved_comparison(const uint8_t* vec1, std::size_t len1,
+                                           const uint8_t* vec2, std::size_t len2,
+                                           std::size_t bytes_per_line = 32,
+                                           std::ostream* output = nullptr,
+                                           std::size_t context_lines = all_lines) {
+        HexWriter out(output ? *output : std::cout);
+        
+        print_interleaved_header(out);
+        if (std::max(len1, len2) > 0) {
+            print_ruler(out, bytes_per_line);
+        }
+        print_windows(vec1, len1, vec2, len2, bytes_per_line, context_lines, out,
+                      [&](const uint8_t* v1, std::size_t l1, const uint8_t* v2, std::size_t l2,
+                          std::size_t base) {
+                          print_interleaved_rows(v1, l1, v2, l2, bytes_per_line, out, base);
+                      });
+        print_legend(out);
+    }
+    
+    // Joins difference ranges, added in ascending order, into the stretches
+    // of whole lines within context_lines lines of a difference, clipped to
+    // [low, high). Stretches that touch are joined; f(begin, end) is called
+    // once a stretch is complete.
+    class ContextWindows {
+    public:
+        ContextWindows(std::size_t bytes_per_line, std::size_t context_lines, std::size_t low,
+                       std::size_t high)
+            : bytes_per_line_(bytes_per_line), context_lines_(context_lines), low_(low),
+              high_(high) {}
+
+        template <typename F>
+        void add(const DiffRange& range, F&& f) {
+            std::size_t first_line = range.offset / bytes_per_line_;
+            std::size_t last_line = (range.end() - 1) / bytes_per_line_;
+            std::size_t lines_before = std::min(context_lines_, first_line);
+            std::size_t lines_after = std::min(context_lines_, high_ / bytes_per_line_ + 1);
+            std::size_t lo = std::max((first_line - lines_before) * bytes_per_line_, low_);
+            std::size_t hi = std::min((last_line + 1 + lines_after) * bytes_per_line_, high_);
+            if (open_ && lo <= end_) {
+                end_ = std::max(end_, hi);
+                return;
+            }
+            finish(f);
+            begin_ = lo;
+            end_ = hi;
+            open_ = true;
+        }
+
+        template <typename F>
+        void finish(F&& f) {
+            if (open_) {
+                open_ = false;
+                f(begin_, end_);
+            }
+        }
+
+    private:
+        std::size_t bytes_per_line_;
+        std::size_t context_lines_;
+        std::size_t low_;
+        std::size_t high_;
+        std::size_t begin_ = 0;
+        std::size_t end_ = 0;
+        bool open_ = false;
+    };
+
+    // Calls f(begin, end) for every stretch of whole lines within
+    // context_lines lines of a difference, in order; stretches that touch
+    // are joined. With all_lines, the one stretch is the whole input.
+    template <typename F>
+    static void for_each_context_window(const uint8_t* vec1, std::size_t len1,
+                                        const uint8_t* vec2, std::size_t len2,
+                                        std::size_t bytes_per_line, std::size_t context_lines,
+                                        F&& f) {
+        std::size_t max_size = std::max(len1, len2);
+        if (max_size == 0) {
+            return;
+        }
+        if (context_lines == all_lines) {
+            f(std::size_t(0), max_size);
+            return;
+        }
+        ContextWindows windows(bytes_per_line, context_lines, 0, max_size);
+        for_each_difference_range(vec1, len1, vec2, len2,
+                                  [&](DiffRange range) { windows.add(range, f); });
+        windows.finish(f);
+    }
+    
+    static void print_comparison_header(HexWriter& out) {
+        out << Colors::BOLD << Colors::CYAN << "Vector comparison (showing hex values, 32 bytes per line):" << Colors::RESET << "\n";
+        out << Colors::BOLD << "Position   | Vec1 Data";
+        out.repeat(' ', 117) << "| Vec2 Data";
+        out.repeat(' ', 117) << "|" << Colors::RESET << "\n";
+        out.repeat('-', 11) << "|";
+        out.repeat('-', 120) << "|";
+        out.repeat('-', 120) << "|" << "\n";
+    }
+    
+    static void print_interleaved_header(HexWriter& out) {
+        out << Colors::BOLD << Colors::CYAN << "Interleaved Vector Comparison (32 bytes per line):" << Colors::RESET << "\n";
+        out << Colors::BOLD << "Position   | Data (Vec1 then Vec2 on adjacent lines)" << Colors::RESET << "\n";
+        out.repeat('-', 11) << "|";
+        out.repeat('-', 101) << "\n";
+    }
+    
+    // Column offsets above the interleaved rows, marked every 16 bytes
+    static void print_ruler(HexWriter& out, std::size_t bytes_per_line) {
+        out << Colors::CYAN << "           | Ruler:";
+        for (std::size_t j = 0; j < bytes_per_line; ++j) {
+            if (j % 16 == 0) {
+                out << Colors::BOLD << Colors::BLUE;
+                out.hex(j, 2) << Colors::RESET;
+            } else {
+                out << Colors::CYAN << ".." << Colors::RESET;
+            }
+            out << " ";
+        }
+        out << "\n";
+        out << "           |";
+        out.repeat('-', 101) << "\n";
+    }
+    
+    // Stands for bytes identical bytes that are not printed
+    static void print_elision(HexWriter& out, std::size_t bytes) {
+        out << Colors::CYAN << "           | ... ";
+        out.dec(bytes) << " identical bytes ..." << Colors::RESET << "\n";
+    }
+    
+    // The rows of print_comparison without header or legend; positions
+    // are labelled from base_offset, for showing a window of larger inputs
+    static void print_comparison_rows(const uint8_t* vec1, std::size_t len1,
+                                      const uint8_t* vec2, std::size_t len2,
+                                      std::size_t bytes_per_line, HexWriter& out,
+                                      std::size_t base_offset = 0) {
+        std::size_t max_size = std::max(len1, len2);
+        
+        for (std::size_t i = 0; i < max_size; i += bytes_per_line) {
+            std::size_t printed_bytes = std::min(bytes_per_line, max_size - i);
+            std::size_t rest1 = len1 - std::min(len1, i);
+            std::size_t rest2 = len2 - std::min(len2, i);
+            
+            // Print position
+            out << Colors::BLUE;
+            out.hex(base_offset + i, 8) << Colors::RESET << "   | ";
+            
+            // Print vec1 line with color coding, padded to fixed width
+            print_bytes(out, vec1 + i, rest1, vec2 + i, rest2, printed_bytes);
+            out.repeat(' ', 3 * (bytes_per_line - printed_bytes)) << "| ";
+            
+            // Print vec2 line with color coding
+            print_bytes(out, vec2 + i, rest2, vec1 + i, rest1, printed_bytes);
+            out.repeat(' ', 3 * (bytes_per_line - printed_bytes)) << "|\n";
+        }
+    }
+    
+    static void print_comparison_rows(const uint8_t* vec1, std::size_t len1,
+                                      const uint8_t* vec2, std::size_t len2,
+                                      std::size_t bytes_per_line, std::ostream& out,
+                                      std::size_t base_offset = 0) {
+        HexWriter writer(out);
+        print_comparison_rows(vec1, len1, vec2, len2, bytes_per_line, writer, base_offset);
+    }
+    
+    // The rows of print_interleaved_comparison, labelled from base_offset
+    static void print_interleaved_rows(const uint8_t* vec1, std::size_t len1,
+                                       const uint8_t* vec2, std::size_t len2,
+                                       std::size_t bytes_per_line, HexWriter& out,
+                                       std::size_t base_offset = 0) {
+        std::size_t max_size = std::max(len1, len2);
+        
+        for (std::size_t i = 0; i < max_size; i += bytes_per_line) {
+            std::size_t printed_bytes = std::min(bytes_per_line, max_size - i);
+            std::size_t rest1 = len1 - std::min(len1, i);
+            std::size_t rest2 = len2 - std::min(len2, i);
+            
+            // Print position for this chunk
+            out << Colors::BLUE;
+            out.hex(base_offset + i, 8) << Colors::RESET << "   | ";
+            
+            // Print vec1 line, then vec2 directly below it
+            out << Colors::BOLD << "Vec1: " << Colors::RESET;
+            print_bytes(out, vec1 + i, rest1, vec2 + i, rest2, printed_bytes);
+            out << "\n";
+            out << "           | " << Colors::BOLD << "Vec2: " << Colors::RESET;
+            print_bytes(out, vec2 + i, rest2, vec1 + i, rest1, printed_bytes);
+            out << "\n";
+            
+            // Print difference indicators (^ symbols) under differing positions
+            out << "           | ";
+            out.repeat(' ', 6); // Align with "Vec2: " prefix
+            for (std::size_t j = 0; j < printed_bytes; ++j) {
+                if (j >= rest1 || j >= rest2 || vec1[i + j] != vec2[i + j]) {
+                    out << Colors::RED << "^" << Colors::RESET << "  ";
+                } else {
+                    out << "   ";
+                }
+            }
+            out << "\n";
+            
+            // Add a separator line between chunks for clarity
+            if (i + bytes_per_line < max_size) {
+                out << "           |";
+                out.repeat('.', 101) << "\n";
+            }
+        }
+    }
+    
+    static void print_interleaved_rows(const uint8_t* vec1, std::size_t len1,
+                                       const uint8_t* vec2, std::size_t len2,
+                                       std::size_t bytes_per_line, std::ostream& out,
+                                       std::size_t base_offset = 0) {
+        HexWriter writer(out);
+        print_interleaved_rows(vec1, len1, vec2, len2, bytes_per_line, writer, base_offset);
+    }
+    
+    static void print_legend(HexWriter& out) {
+        out << "\n" << Colors::BOLD << "Legend:" << Colors::RESET << "\n";
+        out << Colors::GREEN << "●" << Colors::RESET << " Matching bytes  ";
+        out << Colors::BG_RED << Colors::WHITE << "●" << Colors::RESET << " Different bytes  ";
+        out << Colors::YELLOW << "●" << Colors::RESET << " Missing bytes\n";
+    }
+    
+    // Compact difference summary
+    static void print_differences(const uint8_t* vec1, std::size_t len1,
+                                const uint8_t* vec2, std::size_t len2,
+                                std::ostream* output = nullptr) {
+        std::ostream& out = output ? *output : std::cout;
+        std::size_t total = count_differences(vec1, len1, vec2, len2);
+        
+        if (total == 0) {
+            out << "✓ Vectors are identical\n";
+            return;
+        }
+        
+        out << "✗ Found " << total << " differences:\n";
+        out << "Pos   | Vec1 | Vec2 | Decimal Diff\n";
+        out << "------|------|------|-------------\n";
+        
+        for_each_difference(vec1, len1, vec2, len2, [&](std::size_t position, uint8_t value1, uint8_t value2) {
+            out << std::setfill(' ') << std::setw(5) << std::dec << position << " | "
+                     << std::setfill('0') << std::setw(2) << std::hex 
+                     << static_cast<unsigned>(value1) << "   | "
+                     << std::setfill('0') << std::setw(2) << std::hex 
+                     << static_cast<unsigned>(value2) << "   | "
+                     << std::dec << static_cast<int>(value2) - static_cast<int>(value1) << "\n";
+        });
+    }
+    
+    // Differences between two arrays of packed records, one line per
+    // changed field (see field_diff.h). field_names, if given, holds one
+    // name per field of the layout; bytes after the last whole record of
+    // the shorter input are not compared.
+    template <typename Layout>
+    static void print_field_differences(const uint8_t* vec1, std::size_t len1,
+                                        const uint8_t* vec2, std::size_t len2,
+                                        std::ostream* output = nullptr,
+                                        const char* const* field_names = nullptr) {
+        std::ostream& out = output ? *output : std::cout;
+        constexpr std::size_t record_bytes = field_table<record_layout_t<Layout>>::record_bytes;
+        std::size_t records = std::min(len1, len2) / record_bytes;
+        
+        std::size_t total = 0;
+        std::size_t changed_records = 0;
+        std::size_t last = 0;
+        for_each_field_difference<Layout>(vec1, vec2, records, [&](const field_difference& d) {
+            changed_records += total == 0 || d.record != last;
+            last = d.record;
+            ++total;
+        });
+        if (total == 0) {
+            out << "✓ All " << records << " records are identical\n";
+            return;
+        }
+        
+        out << "✗ Found " << total << " field differences in " << changed_records << " of "
+            << records << " records:\n";
+        out << "Record   | Field        | Old                | New                | Changed bits\n";
+        out << "---------|--------------|--------------------|--------------------|-------------------\n";
+        
+        HexWriter writer(out);
+        for_each_field_difference<Layout>(vec1, vec2, records, [&](const field_difference& d) {
+            std::string index = std::to_string(d.record);
+            writer.repeat(' ', index.size() < 8 ? 8 - index.size() : 0) << index << " | ";
+            std::string field = field_names ? field_names[d.field] : "#" + std::to_string(d.field);
+            writer << field;
+            writer.repeat(' ', field.size() < 12 ? 12 - field.size() : 0) << " | 0x";
+            writer.hex(d.old_value, 16) << " | 0x";
+            writer.hex(d.new_value, 16) << " | " << Colors::RED << "0x";
+            writer.hex(d.changed_bits, 16) << Colors::RESET << "\n";
+        });
+    }
+    
+    // One edit of a block diff per line: kind, old and new offset, length
+    static void print_block_edit(HexWriter& out, const block_edit& edit) {
+        switch (edit.kind) {
+            case edit_kind::keep:
+                out << "keep  ";
+                break;
+            case edit_kind::move:
+                out << Colors::YELLOW << "move  ";
+                break;
+            case edit_kind::insert:
+                out << Colors::GREEN << "insert";
+                break;
+            case edit_kind::remove:
+                out << Colors::RED << "remove";
+                break;
+        }
+        out << "  old ";
+        out.hex(edit.old_offset, 8) << "  new ";
+        out.hex(edit.new_offset, 8) << "  ";
+        out.dec(edit.length) << (edit.length == 1 ? " byte" : " bytes") << Colors::RESET << "\n";
+    }
+    
+    // Shift-tolerant comparison (see block_diff.h): the edits that turn
+    // vec1 into vec2, so an inserted byte costs one line instead of
+    // marking everything after it as different
+    static void print_block_edits(const uint8_t* vec1, std::size_t len1,
+                                  const uint8_t* vec2, std::size_t len2,
+                                  std::ostream* output = nullptr,
+                                  const block_diff_options& options = {}) {
+        HexWriter out(output ? *output : std::cout);
+        std::vector<block_match> matches = block_diff(vec1, len1, vec2, len2, options);
+        std::size_t totals[4] = {0, 0, 0, 0};
+        
+        out << Colors::BOLD << Colors::CYAN << "Block diff (";
+        out.dec(block_index::choose_block_size(len1, options));
+        out << "-byte blocks):" << Colors::RESET << "\n";
+        for_each_block_edit(matches, len1, len2, [&](const block_edit& edit) {
+            totals[static_cast<int>(edit.kind)] += edit.length;
+            print_block_edit(out, edit);
+        });
+        out << "Kept: ";
+        out.dec(totals[0]) << "  moved: ";
+        out.dec(totals[1]) << "  inserted: ";
+        out.dec(totals[2]) << "  removed: ";
+        out.dec(totals[3]) << " bytes\n";
+    }
+    
+    // Statistical summary
+    static void print_statistics(const uint8_t* vec1, std::size_t len1,
+                               const uint8_t* vec2, std::size_t len2,
+                               std::ostream* output = nullptr) {
+        std::ostream& out = output ? *output : std::cout;
+        std::size_t total = count_differences(vec1, len1, vec2, len2);
+        std::size_t runs = 0;
+        for_each_difference_range(vec1, len1, vec2, len2, [&](DiffRange) { ++runs; });
+        std::size_t common_length = std::min(len1, len2);
+        std::size_t max_length = std::max(len1, len2);
+        
+        out << "\n=== Comparison Statistics ===\n";
+        out << "Vector 1 size: " << len1 << " bytes\n";
+        out << "Vector 2 size: " << len2 << " bytes\n";
+        out << "Size difference: " << static_cast<int>(len2) - static_cast<int>(len1) << " bytes\n";
+        out << "Total differences: " << total << "\n";
+        out << "Difference runs: " << runs << "\n";
+        out << "Common length: " << common_length << " bytes\n";
+        
+        if (max_length > 0) {
+            double match_ratio = static_cast<double>(max_length - total) / max_length * 100.0;
+            out << "Match ratio: " << std::fixed << std::setprecision(2) << match_ratio << "%\n";
+        }
+    }
+    
+private:
+    // count bytes of one side in color: matching, different from the other
+    // side, or "--" where this side has ended (rest bytes are left)
+    static void print_bytes(HexWriter& out, const uint8_t* bytes, std::size_t rest,
+                            const uint8_t* other, std::size_t other_rest, std::size_t count) {
+        for (std::size_t j = 0; j < count; ++j) {
+            if (j < rest) {
+                if (j >= other_rest || bytes[j] != other[j]) {
+                    out << Colors::BG_RED << Colors::WHITE;
+                } else {
+                    out << Colors::GREEN;
+                }
+                out.hex_byte(bytes[j]) << Colors::RESET << " ";
+            } else {
+                out << Colors::YELLOW << "--" << Colors::RESET << " ";
+            }
+        }
+    }
+    
+    // Prints the context windows with rows(v1, l1, v2, l2, base) and an
+    // elision line for every stretch between them
+    template <typename Rows>
+    static void print_windows(const uint8_t* vec1, std::size_t len1,
+                              const uint8_t* vec2, std::size_t len2,
+                              std::size_t bytes_per_line, std::size_t context_lines,
+                              HexWriter& out, Rows&& rows) {
+        std::size_t shown = 0;
+        for_each_context_window(vec1, len1, vec2, len2, bytes_per_line, context_lines,
+                                [&](std::size_t begin, std::size_t end) {
+            if (begin > shown) {
+                print_elision(out, begin - shown);
+            }
+            rows(vec1 + begin, std::min(len1, end) - std::min(len1, begin),
+                 vec2 + begin, std::min(len2, end) - std::min(len2, begin), begin);
+            shown = end;
+        });
+        std::size_t max_size = std::max(len1, len2);
+        if (context_lines != all_lines && max_size > shown) {
+            print_elision(out, max_size - shown);
+        }
+    }
+};
+
+// Quick utility functions for common use cases
+namespace VectorDiff {
+    // Quick check if memory regions are identical
+    inline bool are_identical(const uint8_t* vec1, std::size_t len1, const uint8_t* vec2, std::size_t len2,
+                       thread_pool* pool = nullptr) {
+        if (len1 != len2) return false;
+        return (pool != nullptr ? parallel_find_mismatch(vec1, vec2, len1, *pool)
+                                : find_mismatch(vec1, vec2, len1)) == len1;
+    }
+    
+    // Find first difference position; with a pool, chunks past the first
+    // mismatching one are not scanned
+    inline std::optional<std::size_t> first_difference(const uint8_t* vec1, std::size_t len1,
+                                               const uint8_t* vec2, std::size_t len2,
+                                               thread_pool* pool = nullptr) {
+        std::size_t min_len = std::min(len1, len2);
+        std::size_t position = pool != nullptr ? parallel_find_mismatch(vec1, vec2, min_len, *pool)
+                                               : find_mismatch(vec1, vec2, min_len);
+        if (position != min_len) {
+            return position;
+        }
+        // Check if one is longer than the other
+        if (len1 != len2) {
+            return min_len;
+        }
+        return std::nullopt;
+    }
+    
+    // Count total differences
+    inline std::size_t count_differences(const uint8_t* vec1, std::size_t len1,
+                                const uint8_t* vec2, std::size_t len2,
+                                thread_pool* pool = nullptr) {
+        return VectorComparator::count_differences(vec1, len1, vec2, len2, pool);
+    }
+    
+    // Generate diff string (similar to unified diff format): one line per
+    // changed run with its old and new bytes, from the positional delta
+    inline std::string generate_diff_string(const uint8_t* vec1, std::size_t len1,
+                                   const uint8_t* vec2, std::size_t len2) {
+        std::ostringstream oss;
+        std::size_t total = VectorComparator::count_differences(vec1, len1, vec2, len2);
+        
+        if (total == 0) {
+            oss << "No differences found\n";
+            return oss.str();
+        }
+        
+        oss << "--- Vector1\n";
+        oss << "+++ Vector2\n";
+        oss << "@@ Differences: " << total << " @@\n";
+        
+        std::vector<uint8_t> delta = encode_positional_delta(vec1, len1, vec2, len2);
+        dump_delta(vec1, len1, delta.data(), delta.size(), oss);
+        return oss.str();
+    }
+}
+
+#endif // VECTOR_COMPARATOR_H
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "seq.h"
+#include <stdexcept>
 #include <type_traits>
 
 // Test total_seq_helper basic functionality
@@ -55,6 +56,21 @@ TEST(SeqTest, GetValueAt) {
     static_assert(get_value_at<1, 100, 200, 300> == 200);
 }
 
+// Test value_at with a runtime index
+TEST(SeqTest, ValueAtRuntimeIndex) {
+    static_assert(value_at<5, 10, 15, 20>(3) == 20);
+    static_assert(total_seq_helper<7, 8, 9>::value_at(1) == 8);
+
+    int sum = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+        sum += value_at<5, 10, 15, 20>(i);
+    }
+    EXPECT_EQ(sum, 50);
+
+    EXPECT_THROW((value_at<5, 10, 15, 20>(4)), std::out_of_range);
+    EXPECT_THROW((total_seq_helper<7, 8, 9>::value_at(~std::size_t{0})), std::out_of_range);
+}
+
 // Test make_total_value_sequence
 TEST(SeqTest, MakeTotalValueSequence) {
     using seq = make_total_value_sequence<1, 2, 3>;
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "binary_delta.h"
+#include "test_helpers.h"
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+std::vector<std::uint8_t> patched(const std::vector<std::uint8_t>& base,
+                                  const std::vector<std::uint8_t>& delta) {
+    std::vector<std::uint8_t> target;
+    EXPECT_TRUE(apply_delta(base.data(), base.size(), delta.data(), delta.size(), target));
+    return target;
+}
+
+}  // namespace
+
+TEST(BinaryDeltaTest, Varints) {
+    for (std::uint64_t value : {0ull, 1ull, 127ull, 128ull, 300ull, ~0ull}) {
+        std::vector<std::uint8_t> bytes;
+        put_varint(bytes, value);
+        const std::uint8_t* p = bytes.data();
+        std::uint64_t decoded;
+        ASSERT_TRUE(get_varint(p, bytes.data() + bytes.size(), decoded));
+        EXPECT_EQ(decoded, value);
+        EXPECT_EQ(p, bytes.data() + bytes.size());
+        const std::uint8_t* q = bytes.data();
+        EXPECT_FALSE(get_varint(q, bytes.data() + bytes.size() - 1, decoded));
+    }
+}
+
+TEST(BinaryDeltaTest, PositionalDelta) {
+    std::vector<std::uint8_t> base = random_bytes(100000, 1);
+    std::vector<std::uint8_t> target = base;
+    target[10] ^= 1;
+    target[12] ^= 1;  // two bytes apart: one replace of three bytes
+    for (std::size_t i = 50000; i < 50100; ++i) {
+        target[i] = 0;
+    }
+    target.insert(target.end(), {1, 2, 3});
+
+    std::vector<std::uint8_t> delta =
+        encode_positional_delta(base.data(), base.size(), target.data(), target.size());
+    EXPECT_EQ(patched(base, delta), target);
+    EXPECT_LT(delta.size(), 140u);
+
+    std::size_t replaces = 0;
+    EXPECT_TRUE(for_each_delta_op(
+        delta.data(), delta.size(), base.size(),
+        [&](delta_op op, std::size_t, std::size_t, std::size_t, const std::uint8_t*) {
+            replaces += op == delta_op::replace;
+        }));
+    EXPECT_EQ(replaces, 2u);
+
+    // A shorter target drops the end of the base
+    target.resize(30000);
+    delta = encode_positional_delta(base.data(), base.size(), target.data(), target.size());
+    EXPECT_EQ(patched(base, delta), target);
+
+    delta = encode_positional_delta(base.data(), base.size(), base.data(), base.size());
+    EXPECT_EQ(patched(base, delta), base);
+}
+
+TEST(BinaryDeltaTest, ShiftTolerantDelta) {
+    std::vector<std::uint8_t> base = random_bytes(200000, 2);
+    std::vector<std::uint8_t> target = base;
+    target.insert(target.begin() + 1000, 7, 0x42);
+    target.erase(target.begin() + 90000, target.begin() + 90500);
+    std::copy(base.begin(), base.begin() + 4000, std::back_inserter(target));
+    target[150000] ^= 0x80;
+
+    std::vector<std::uint8_t> delta =
+        encode_delta(base.data(), base.size(), target.data(), target.size());
+    EXPECT_EQ(patched(base, delta), target);
+    // A handful of operations, where a positional delta holds most of the target
+    EXPECT_LT(delta.size(), 64u);
+    EXPECT_GT(encode_positional_delta(base.data(), base.size(), target.data(), target.size())
+                  .size(),
+              100000u);
+
+    std::vector<std::uint8_t> empty;
+    delta = encode_delta(base.data(), base.size(), empty.data(), 0);
+    EXPECT_EQ(patched(base, delta), empty);
+    delta = encode_delta(empty.data(), 0, target.data(), target.size());
+    EXPECT_EQ(patched(empty, delta), target);
+}
+
+TEST(BinaryDeltaTest, RejectsBadDeltas) {
+    std::vector<std::uint8_t> base = random_bytes(5000, 3);
+    std::vector<std::uint8_t> target = base;
+    target[100] = 0;
+    std::vector<std::uint8_t> delta =
+        encode_delta(base.data(), base.size(), target.data(), target.size());
+    std::vector<std::uint8_t> out;
+
+    // Wrong base size, truncated, trailing garbage, bad magic
+    EXPECT_FALSE(apply_delta(base.data(), base.size() - 1, delta.data(), delta.size(), out));
+    for (std::size_t n = 0; n < delta.size(); ++n) {
+        EXPECT_FALSE(apply_delta(base.data(), base.size(), delta.data(), n, out)) << n;
+    }
+    std::vector<std::uint8_t> longer = delta;
+    longer.push_back(0);
+    EXPECT_FALSE(apply_delta(base.data(), base.size(), longer.data(), longer.size(), out));
+    std::vector<std::uint8_t> magic = delta;
+    magic[0] = 'x';
+    EXPECT_FALSE(apply_delta(base.data(), base.size(), magic.data(), magic.size(), out));
+
+    // A copy reaching past the end of the base
+    delta_writer writer(10, 8);
+    writer.copy(4, 8);
+    std::vector<std::uint8_t> bad = writer.finish();
+    EXPECT_FALSE(apply_delta(base.data(), 10, bad.data(), bad.size(), out));
+
+    // A replace overwriting past the end of the base, alone or after a copy;
+    // dump_delta must not read those base bytes either
+    delta_writer long_replace(10, 100);
+    long_replace.replace(base.data(), 100);
+    bad = long_replace.finish();
+    EXPECT_FALSE(apply_delta(base.data(), 10, bad.data(), bad.size(), out));
+    std::ostringstream dump;
+    EXPECT_FALSE(dump_delta(base.data(), 10, bad.data(), bad.size(), dump));
+    EXPECT_EQ(dump.str().find("replace"), std::string::npos);
+    delta_writer late_replace(10, 12);
+    late_replace.copy(0, 8);
+    late_replace.replace(base.data(), 4);
+    bad = late_replace.finish();
+    EXPECT_FALSE(apply_delta(base.data(), 10, bad.data(), bad.size(), out));
+
+    // A target size the operations do not add up to is not allocated
+    delta_writer huge(10, std::size_t(1) << (sizeof(std::size_t) * 8 - 2));
+    huge.copy(0, 10);
+    bad = huge.finish();
+    EXPECT_FALSE(apply_delta(base.data(), 10, bad.data(), bad.size(), out));
+
+    // The raw form checks the output size
+    std::vector<std::uint8_t> buffer(target.size() + 1);
+    EXPECT_FALSE(apply_delta(base.data(), base.size(), delta.data(), delta.size(), buffer.data(),
+                             buffer.size()));
+    EXPECT_TRUE(apply_delta(base.data(), base.size(), delta.data(), delta.size(), buffer.data(),
+                            target.size()));
+}
+
+TEST(BinaryDeltaTest, Dump) {
+    std::vector<std::uint8_t> base = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<std::uint8_t> target = {0, 1, 2, 3, 0xaa, 5, 6, 7, 8, 9, 0xbb};
+    std::vector<std::uint8_t> delta =
+        encode_positional_delta(base.data(), base.size(), target.data(), target.size());
+    std::ostringstream out;
+    EXPECT_TRUE(dump_delta(base.data(), base.size(), delta.data(), delta.size(), out));
+    EXPECT_EQ(out.str(),
+              "delta: " + std::to_string(delta.size()) +
+                  " bytes, base 10 bytes, target 11 bytes\n"
+                  "copy     base 00000000  target 00000000  4 bytes\n"
+                  "replace  base 00000004  target 00000004  1 byte\n"
+                  "  - 04\n"
+                  "  + aa\n"
+                  "copy     base 00000005  target 00000005  5 bytes\n"
+                  "insert   base 0000000a  target 0000000a  1 byte\n"
+                  "  + bb\n");
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "bit_layout.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+// A join key scattered over a word: tenant (8), pad (4), region (6), pad (10),
+// day (12), pad (24)
+using Row = bit_layout<8, 4, 6, 10, 12, 24>;
+
+}  // namespace
+
+TEST(BitLayoutTest, Masks) {
+    static_assert(Row::offset<2> == 12);
+    static_assert(Row::field_mask<2> == 0x3full << 12);
+    static_assert(Row::mask<0, 2, 4> == (0xffull | 0x3full << 12 | 0xfffull << 28));
+    static_assert(bit_layout<64>::field_mask<0> == ~0ull);
+    static_assert(pext_portable(0xf0f0, 0xff00) == 0xf0);
+    static_assert(pdep_portable(0xf0, 0xff00) == 0xf000);
+}
+
+TEST(BitLayoutTest, GatherScatter) {
+    std::uint64_t word = 0xabull | 0x5ull << 8 | 0x2aull << 12 | 0x3ffull << 18 |
+                         0x123ull << 28 | 0xffffffull << 40;
+    std::uint64_t key = Row::gather<0, 2, 4>(word);
+    EXPECT_EQ(key, 0xabull | 0x2aull << 8 | 0x123ull << 14);
+    static_assert(Row::gather_portable<0, 2, 4>(0x2aull << 12) == 0x2aull << 8);
+
+    std::uint64_t updated = Row::scatter<0, 2, 4>(word, 0x11ull | 0x3ull << 8 | 0xfffull << 14);
+    EXPECT_EQ((Row::gather<1, 3, 5>(updated)), (Row::gather<1, 3, 5>(word)));
+    EXPECT_EQ(Row::gather<0>(updated), 0x11u);
+    EXPECT_EQ(Row::gather<2>(updated), 0x3u);
+    EXPECT_EQ(Row::gather<4>(updated), 0xfffu);
+}
+
+TEST(BitLayoutTest, MatchesPortablePext) {
+    std::mt19937_64 rng(42);
+    constexpr std::uint64_t mask = Row::mask<0, 2, 4>;
+    for (int i = 0; i < 1000; ++i) {
+        std::uint64_t word = rng();
+        std::uint64_t key = rng() & low_bits_mask(26);
+        EXPECT_EQ((Row::gather<0, 2, 4>(word)), pext_portable(word, mask));
+        EXPECT_EQ((Row::scatter<0, 2, 4>(word, key)), (word & ~mask) | pdep_portable(key, mask));
+    }
+}
+
+TEST(BitLayoutTest, BulkKernels) {
+    std::mt19937_64 rng(7);
+    std::vector<std::uint64_t> words(1000);
+    for (std::uint64_t& word : words) {
+        word = rng();
+    }
+    std::vector<std::uint64_t> keys(words.size());
+    Row::gather_n<2, 3, 5>(words.data(), keys.data(), words.size());
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        ASSERT_EQ(keys[i], (Row::gather_portable<2, 3, 5>(words[i])));
+    }
+
+    std::vector<std::uint64_t> expected(words.size());
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        keys[i] = ~keys[i];
+        expected[i] = Row::scatter_portable<2, 3, 5>(words[i], keys[i]);
+    }
+    Row::scatter_n<2, 3, 5>(words.data(), keys.data(), words.size());
+    EXPECT_EQ(words, expected);
+}
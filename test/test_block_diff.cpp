@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "block_diff.h"
+#include "test_helpers.h"
+#include "vector_comparator.h"
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+std::vector<block_edit> edits(const std::vector<std::uint8_t>& a,
+                              const std::vector<std::uint8_t>& b,
+                              const block_diff_options& options = {}) {
+    std::vector<block_edit> result;
+    for_each_block_edit(block_diff(a.data(), a.size(), b.data(), b.size(), options), a.size(),
+                        b.size(), [&](const block_edit& e) { result.push_back(e); });
+    return result;
+}
+
+// Rebuilds the new buffer from the old one and the edits
+std::vector<std::uint8_t> apply(const std::vector<std::uint8_t>& a,
+                                const std::vector<std::uint8_t>& b,
+                                const std::vector<block_edit>& edits) {
+    std::vector<std::uint8_t> out;
+    for (const block_edit& e : edits) {
+        if (e.kind == edit_kind::keep || e.kind == edit_kind::move) {
+            EXPECT_EQ(e.new_offset, out.size());
+            out.insert(out.end(), a.begin() + e.old_offset, a.begin() + e.old_offset + e.length);
+        } else if (e.kind == edit_kind::insert) {
+            EXPECT_EQ(e.new_offset, out.size());
+            out.insert(out.end(), b.begin() + e.new_offset, b.begin() + e.new_offset + e.length);
+        }
+    }
+    return out;
+}
+
+using K = edit_kind;
+
+}  // namespace
+
+TEST(BlockDiffTest, BlockSizeFollowsBudget) {
+    block_diff_options options;
+    EXPECT_EQ(block_index::choose_block_size(1 << 20, options), 32u);
+    options.memory_budget = 64 << 10;
+    // 64 KiB holds 8192 slots, enough for 4096 blocks of 256 bytes
+    EXPECT_EQ(block_index::choose_block_size(1 << 20, options), 256u);
+    EXPECT_LE(block_index::index_bytes((1 << 20) / 256), options.memory_budget);
+    // An explicit size is a starting point that still has to fit the budget
+    options.block_size = 100;
+    EXPECT_EQ(block_index::choose_block_size(1 << 20, options), 400u);
+    options.memory_budget = block_diff_options{}.memory_budget;
+    EXPECT_EQ(block_index::choose_block_size(1 << 20, options), 100u);
+}
+
+TEST(BlockDiffTest, BlockCountFitsTheSlots) {
+    if (sizeof(std::size_t) < 8) {
+        GTEST_SKIP() << "needs a 64-bit size_t";
+    }
+    // Block numbers are stored as block + 1 in 32 bits, so an explicit size
+    // may not give more than max_blocks blocks, whatever the budget
+    std::size_t old_size = std::size_t(1) << 40;
+    block_diff_options options;
+    options.block_size = 1;
+    options.memory_budget = ~std::size_t(0);
+    std::size_t size = block_index::choose_block_size(old_size, options);
+    EXPECT_LE(old_size / size, block_index::max_blocks);
+    EXPECT_EQ(size, 512u);
+    EXPECT_THROW(block_index(nullptr, old_size, 1), std::length_error);
+}
+
+TEST(BlockDiffTest, IdenticalAndEmpty) {
+    std::vector<std::uint8_t> a = random_bytes(10000, 1);
+    EXPECT_EQ(edits(a, a), (std::vector<block_edit>{{K::keep, 0, 0, 10000}}));
+
+    std::vector<std::uint8_t> none;
+    EXPECT_EQ(edits(none, a), (std::vector<block_edit>{{K::insert, 0, 0, 10000}}));
+    EXPECT_EQ(edits(a, none), (std::vector<block_edit>{{K::remove, 0, 0, 10000}}));
+    EXPECT_TRUE(edits(none, none).empty());
+}
+
+TEST(BlockDiffTest, InsertedAndDeletedBytes) {
+    std::vector<std::uint8_t> a = random_bytes(100000, 2);
+    std::vector<std::uint8_t> b = a;
+    b.insert(b.begin() + 5000, 0x42);
+    b.erase(b.begin() + 70001, b.begin() + 70011);
+    EXPECT_EQ(edits(a, b), (std::vector<block_edit>{{K::keep, 0, 0, 5000},
+                                                     {K::insert, 5000, 5000, 1},
+                                                     {K::keep, 5000, 5001, 65000},
+                                                     {K::remove, 70000, 70001, 10},
+                                                     {K::keep, 70010, 70001, 29990}}));
+
+    // A changed byte splits the keep around an insert and a remove of one byte
+    b = a;
+    b[300] ^= 1;
+    std::vector<block_edit> changed = edits(a, b);
+    ASSERT_EQ(changed.size(), 4u);
+    EXPECT_EQ(changed[1], (block_edit{K::insert, 300, 300, 1}));
+    EXPECT_EQ(changed[2], (block_edit{K::remove, 300, 301, 1}));
+    EXPECT_EQ(apply(a, b, changed), b);
+}
+
+TEST(BlockDiffTest, MovedRegions) {
+    std::vector<std::uint8_t> a = random_bytes(30000, 3);
+    // new = [20000, 30000) + [0, 20000): the tail moved to the front
+    std::vector<std::uint8_t> b(a.begin() + 20000, a.end());
+    b.insert(b.end(), a.begin(), a.begin() + 20000);
+    EXPECT_EQ(edits(a, b), (std::vector<block_edit>{{K::keep, 20000, 0, 10000},
+                                                     {K::move, 0, 10000, 20000}}));
+
+    // A block used twice is kept once and moved once
+    std::vector<std::uint8_t> twice(a.begin(), a.begin() + 5000);
+    twice.insert(twice.end(), a.begin(), a.begin() + 5000);
+    EXPECT_EQ(edits(a, twice), (std::vector<block_edit>{{K::keep, 0, 0, 5000},
+                                                         {K::move, 0, 5000, 5000},
+                                                         {K::remove, 5000, 10000, 25000}}));
+}
+
+TEST(BlockDiffTest, RandomEditsRoundTrip) {
+    std::mt19937 rng(4);
+    for (int round = 0; round < 20; ++round) {
+        std::vector<std::uint8_t> a = random_bytes(20000 + rng() % 20000, round);
+        std::vector<std::uint8_t> b = a;
+        for (int k = 0; k < 5; ++k) {
+            std::size_t at = rng() % b.size();
+            switch (rng() % 3) {
+                case 0:
+                    b.insert(b.begin() + at, rng() % 100, static_cast<std::uint8_t>(rng()));
+                    break;
+                case 1:
+                    b.erase(b.begin() + at, b.begin() + std::min(b.size(), at + rng() % 100));
+                    break;
+                default:
+                    b[at] ^= 0xff;
+            }
+        }
+        std::vector<block_edit> result = edits(a, b);
+        EXPECT_EQ(apply(a, b, result), b);
+
+        // Every old byte is kept, moved or removed
+        std::vector<int> used(a.size(), 0);
+        for (const block_edit& e : result) {
+            if (e.kind != K::insert) {
+                for (std::size_t i = e.old_offset; i < e.old_offset + e.length; ++i) {
+                    used[i] = 1;
+                }
+            }
+        }
+        EXPECT_EQ(std::count(used.begin(), used.end(), 0), 0);
+
+        // Far fewer bytes are reported than a positional diff would
+        std::size_t inserted = 0;
+        for (const block_edit& e : result) {
+            inserted += e.kind == K::insert ? e.length : 0;
+        }
+        EXPECT_LT(inserted, 1000u);
+    }
+}
+
+TEST(BlockDiffTest, RepeatedContentStaysAligned) {
+    std::vector<std::uint8_t> a(50000, 0);
+    std::vector<std::uint8_t> b = a;
+    b[25000] = 1;
+    std::vector<block_edit> result = edits(a, b);
+    EXPECT_EQ(apply(a, b, result), b);
+    for (const block_edit& e : result) {
+        EXPECT_NE(e.kind, K::move);
+    }
+}
+
+TEST(BlockDiffTest, PrintBlockEdits) {
+    std::vector<std::uint8_t> a = random_bytes(4096, 5);
+    std::vector<std::uint8_t> b = a;
+    b.insert(b.begin() + 1000, {1, 2, 3});
+    std::ostringstream out;
+    VectorComparator::print_block_edits(a.data(), a.size(), b.data(), b.size(), &out);
+    std::string text = out.str();
+    EXPECT_NE(text.find("32-byte blocks"), std::string::npos);
+    EXPECT_NE(text.find("insert  old 000003e8  new 000003e8  3 bytes"), std::string::npos);
+    EXPECT_NE(text.find("Kept: 4096  moved: 0  inserted: 3  removed: 0 bytes"), std::string::npos);
+}
@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+#include "byte_compare.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<std::size_t> naive_mismatches(const std::uint8_t* a, const std::uint8_t* b,
+                                          std::size_t n) {
+    std::vector<std::size_t> positions;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (a[i] != b[i]) {
+            positions.push_back(i);
+        }
+    }
+    return positions;
+}
+
+}  // namespace
+
+TEST(ByteCompareTest, BitHelpers) {
+    EXPECT_EQ(ctz64(1), 0);
+    EXPECT_EQ(ctz64(0x8000000000000000ull), 63);
+    EXPECT_EQ(ctz64(0x50), 4);
+    EXPECT_EQ(popcount64(0), 0);
+    EXPECT_EQ(popcount64(~0ull), 64);
+}
+
+TEST(ByteCompareTest, KernelsAgreeWithScalar) {
+    std::mt19937 rng(11);
+    std::vector<std::uint8_t> a(1024 + 8);
+    for (std::uint8_t& byte : a) {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+    for (mismatch_block_fn* kernel :
+         runnable_kernels(mismatch_block_kernels(), &mismatch_block_scalar)) {
+        for (std::size_t offset = 0; offset < 8; ++offset) {
+            for (std::size_t n : {0u, 1u, 63u, 64u, 65u, 127u, 200u, 1024u}) {
+                std::vector<std::uint8_t> b(a);
+                std::size_t flip = n == 0 ? 0 : rng() % n;
+                if (n != 0) {
+                    b[offset + flip] ^= 0x10;
+                    b[offset + n - 1] ^= 0x01;
+                }
+                std::uint64_t mask = 1;
+                std::size_t block = kernel(a.data() + offset, b.data() + offset, n, &mask);
+                if (n == 0) {
+                    EXPECT_EQ(block, 0u);
+                    EXPECT_EQ(mask, 0u);
+                    continue;
+                }
+                ASSERT_EQ(block, flip / 64 * 64) << "n=" << n << " offset=" << offset;
+                EXPECT_EQ(mask, mismatch_mask_scalar(a.data() + offset + block,
+                                                     b.data() + offset + block,
+                                                     std::min<std::size_t>(64, n - block)));
+
+                // Equal buffers report no block
+                block = kernel(a.data() + offset, a.data() + offset, n, &mask);
+                EXPECT_EQ(block, n);
+                EXPECT_EQ(mask, 0u);
+            }
+        }
+    }
+}
+
+TEST(ByteCompareTest, FindMismatch) {
+    std::vector<std::uint8_t> a(300, 7);
+    std::vector<std::uint8_t> b(a);
+    EXPECT_EQ(find_mismatch(a.data(), b.data(), a.size()), a.size());
+    b[299] = 8;
+    EXPECT_EQ(find_mismatch(a.data(), b.data(), a.size()), 299u);
+    b[130] = 8;
+    EXPECT_EQ(find_mismatch(a.data(), b.data(), a.size()), 130u);
+    EXPECT_EQ(find_mismatch(a.data(), b.data(), 130), 130u);
+}
+
+TEST(ByteCompareTest, ForEachMismatchMatchesNaive) {
+    std::mt19937 rng(5);
+    for (int density : {0, 1, 20, 100}) {
+        std::vector<std::uint8_t> a(5000);
+        for (std::uint8_t& byte : a) {
+            byte = static_cast<std::uint8_t>(rng());
+        }
+        std::vector<std::uint8_t> b(a);
+        for (std::uint8_t& byte : b) {
+            if (static_cast<int>(rng() % 100) < density) {
+                byte = static_cast<std::uint8_t>(byte + 1);
+            }
+        }
+        for (std::size_t n : {a.size(), a.size() - 37}) {
+            std::vector<std::size_t> positions;
+            for_each_mismatch(a.data() + 3, b.data() + 3, n - 3,
+                              [&](std::size_t i) { positions.push_back(i); });
+            std::vector<std::size_t> expected = naive_mismatches(a.data() + 3, b.data() + 3, n - 3);
+            EXPECT_EQ(positions, expected);
+            EXPECT_EQ(count_mismatches(a.data() + 3, b.data() + 3, n - 3), expected.size());
+        }
+    }
+}
+
+TEST(ByteCompareTest, MismatchRanges) {
+    std::mt19937 rng(9);
+    // Probability of starting or continuing a run, in percent
+    for (int density : {0, 2, 50, 97, 100}) {
+        std::vector<std::uint8_t> a(4099);
+        for (std::uint8_t& byte : a) {
+            byte = static_cast<std::uint8_t>(rng());
+        }
+        std::vector<std::uint8_t> b(a);
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            if (static_cast<int>(rng() % 100) < density) {
+                b[i] = static_cast<std::uint8_t>(~b[i]);
+            }
+        }
+
+        std::vector<mismatch_range> expected;
+        for (std::size_t i : naive_mismatches(a.data(), b.data(), a.size())) {
+            if (!expected.empty() && expected.back().end() == i) {
+                ++expected.back().length;
+            } else {
+                expected.push_back({i, 1});
+            }
+        }
+
+        std::vector<mismatch_range> ranges;
+        for_each_mismatch_range(a.data(), b.data(), a.size(),
+                                [&](mismatch_range r) { ranges.push_back(r); });
+        EXPECT_EQ(ranges, expected) << "density " << density;
+    }
+
+    // One run spanning many blocks is reported once
+    std::vector<std::uint8_t> a(1000, 0);
+    std::vector<std::uint8_t> b(1000, 0);
+    std::fill(b.begin() + 60, b.begin() + 900, 1);
+    std::vector<mismatch_range> ranges;
+    for_each_mismatch_range(a.data(), b.data(), a.size(),
+                            [&](mismatch_range r) { ranges.push_back(r); });
+    EXPECT_EQ(ranges, (std::vector<mismatch_range>{{60, 840}}));
+}
+
+TEST(ByteCompareTest, ChunkSize) {
+    std::size_t chunk = compare_chunk_size();
+    EXPECT_GE(chunk, 64u * 1024);
+    EXPECT_EQ(chunk % check_env::topology().page_size, 0u);
+}
+
+TEST(ByteCompareTest, ParallelMatchesSerial) {
+    thread_pool pool(4);
+    std::size_t chunk = compare_chunk_size();
+    std::size_t n = chunk * 37 + 123;
+    std::vector<std::uint8_t> a(n, 0x33);
+    std::vector<std::uint8_t> b(a);
+    std::mt19937 rng(3);
+    for (int i = 0; i < 200; ++i) {
+        b[rng() % n] = 0;
+    }
+    // Runs across chunk boundaries, and the last byte
+    std::fill(b.begin() + chunk - 10, b.begin() + 3 * chunk + 5, 0);
+    std::fill(b.begin() + 20 * chunk - 1, b.begin() + 20 * chunk + 1, 0);
+    b[n - 1] = 0;
+
+    EXPECT_EQ(parallel_find_mismatch(a.data(), b.data(), n, pool),
+              find_mismatch(a.data(), b.data(), n));
+    EXPECT_EQ(parallel_find_mismatch(a.data(), a.data(), n, pool), n);
+    EXPECT_EQ(parallel_count_mismatches(a.data(), b.data(), n, pool),
+              count_mismatches(a.data(), b.data(), n));
+
+    std::vector<mismatch_range> serial;
+    for_each_mismatch_range(a.data(), b.data(), n, [&](mismatch_range r) { serial.push_back(r); });
+    std::vector<mismatch_range> parallel;
+    parallel_for_each_mismatch_range(a.data(), b.data(), n,
+                                     [&](mismatch_range r) { parallel.push_back(r); }, pool);
+    EXPECT_EQ(parallel, serial);
+}
+
+TEST(ByteCompareTest, ParallelBuffersBoundedRuns) {
+    // Every other byte differs: chunk / 2 runs per chunk
+    thread_pool pool(4);
+    std::size_t chunk = compare_chunk_size();
+    std::size_t n = chunk * 9 + 77;
+    std::vector<std::uint8_t> a(n, 0x33);
+    std::vector<std::uint8_t> b(a);
+    for (std::size_t i = 0; i < n; i += 2) {
+        b[i] = 0;
+    }
+    std::fill(b.begin() + 5 * chunk - 300, b.begin() + 5 * chunk + 300, 0);
+
+    std::vector<mismatch_range> serial;
+    for_each_mismatch_range(a.data(), b.data(), n, [&](mismatch_range r) { serial.push_back(r); });
+
+    // One chunk stops at the limit; the runs it kept and a scan of the rest
+    // together give the serial runs
+    std::vector<mismatch_range> runs;
+    std::size_t stop = collect_mismatch_ranges(a.data(), b.data(), chunk, runs);
+    EXPECT_LE(runs.size(), parallel_run_limit + 31);
+    EXPECT_GE(runs.size(), parallel_run_limit);
+    EXPECT_LT(stop, chunk);
+    EXPECT_EQ(stop % 64, 0u);
+    for_each_mismatch_range(a.data() + stop, b.data() + stop, chunk - stop, [&](mismatch_range r) {
+        runs.push_back({stop + r.offset, r.length});
+    });
+    EXPECT_TRUE(std::equal(runs.begin(), runs.end(), serial.begin()));
+
+    // A run that crosses the stop is continued by the rescan
+    std::vector<std::uint8_t> c(a);
+    std::fill(c.begin(), c.begin() + 1000, 0);
+    runs.clear();
+    stop = collect_mismatch_ranges(a.data(), c.data(), chunk, runs, 1);
+    EXPECT_EQ(stop, 64u);
+    EXPECT_EQ(runs, (std::vector<mismatch_range>{{0, 64}}));
+
+    std::vector<mismatch_range> parallel;
+    parallel_for_each_mismatch_range(a.data(), b.data(), n,
+                                     [&](mismatch_range r) { parallel.push_back(r); }, pool);
+    EXPECT_EQ(parallel, serial);
+}
+
+TEST(ByteCompareTest, ParallelFindStopsAtFirstMismatch) {
+    thread_pool pool(4);
+    std::size_t chunk = compare_chunk_size();
+    std::size_t n = chunk * 64;
+    std::vector<std::uint8_t> a(n, 1);
+    std::vector<std::uint8_t> b(a);
+    b[chunk * 2 + 17] = 2;
+    b[chunk * 50] = 2;
+    EXPECT_EQ(parallel_find_mismatch(a.data(), b.data(), n, pool), chunk * 2 + 17);
+}
@@ -109,3 +109,164 @@ TEST(CheckEnvTest, PerformanceComparison) {
     EXPECT_EQ(sum1, sum2);
     std::cout << "Sum calculated: " << sum1 << std::endl;
 }
+
+namespace {
+
+int tier_baseline(int x) { return x; }
+int tier_sse42(int x) { return x + 1; }
+int tier_avx512(int x) { return x + 3; }
+
+#if CHECK_ENV_X86
+CHECK_ENV_TARGET("popcnt")
+int popcount_sse42(unsigned long long x) { return __builtin_popcountll(x); }
+#endif
+
+int popcount_baseline(unsigned long long x) {
+    int count = 0;
+    for (; x != 0; x &= x - 1) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+// Test runtime CPU feature detection
+TEST(CheckEnvTest, CpuFeatures) {
+    const check_env::cpu_features& features = check_env::cpu();
+    EXPECT_EQ(&features, &check_env::cpu());
+    if (features.avx512bw) {
+        EXPECT_TRUE(features.avx512f);
+    }
+#if !CHECK_ENV_X86
+    EXPECT_EQ(check_env::best_isa_level(), check_env::isa_level::baseline);
+#endif
+#if defined(__AVX2__)
+    EXPECT_TRUE(features.avx2);
+#endif
+#if defined(__SSE4_2__)
+    EXPECT_TRUE(features.sse42);
+#endif
+
+    std::cout << "sse42: " << features.sse42 << " popcnt: " << features.popcnt
+              << " avx2: " << features.avx2 << " bmi2: " << features.bmi2
+              << " avx512f: " << features.avx512f << " avx512bw: " << features.avx512bw
+              << std::endl;
+}
+
+// Test that the highest available tier not above the level is selected
+TEST(CheckEnvTest, SelectKernel) {
+    using check_env::isa_level;
+    check_env::kernel_set<int(int)> set{&tier_baseline, &tier_sse42, nullptr, &tier_avx512};
+    EXPECT_EQ(check_env::select_kernel(set, isa_level::baseline), &tier_baseline);
+    EXPECT_EQ(check_env::select_kernel(set, isa_level::sse42), &tier_sse42);
+    EXPECT_EQ(check_env::select_kernel(set, isa_level::avx2), &tier_sse42);
+    EXPECT_EQ(check_env::select_kernel(set, isa_level::avx512), &tier_avx512);
+
+    check_env::kernel_set<int(int)> baseline_only{&tier_baseline};
+    EXPECT_EQ(check_env::select_kernel(baseline_only, isa_level::avx512), &tier_baseline);
+}
+
+// Test a kernel dispatched on the running CPU
+TEST(CheckEnvTest, KernelDispatch) {
+#if CHECK_ENV_X86
+    static const check_env::kernel<int(unsigned long long)> popcount(
+        {&popcount_baseline, &popcount_sse42});
+#else
+    static const check_env::kernel<int(unsigned long long)> popcount({&popcount_baseline});
+#endif
+    EXPECT_EQ(popcount(0xf0f0ull), 8);
+    EXPECT_EQ(popcount(~0ull), 64);
+    if (check_env::best_isa_level() == check_env::isa_level::baseline) {
+        EXPECT_EQ(popcount.get(), &popcount_baseline);
+    }
+
+    check_env::kernel<int(int)> forced({&tier_baseline, &tier_sse42}, check_env::isa_level::baseline);
+    EXPECT_EQ(forced(1), 1);
+}
+
+// Test unaligned loads and stores at every offset
+TEST(CheckEnvTest, LoadStoreUnaligned) {
+    alignas(8) uint8_t buffer[24];
+    for (int i = 0; i < 24; ++i) {
+        buffer[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+    for (int offset = 0; offset < 8; ++offset) {
+        uint64_t expected64;
+        std::memcpy(&expected64, buffer + offset, sizeof(expected64));
+        EXPECT_EQ(check_env::load_unaligned<uint64_t>(buffer + offset), expected64);
+
+        uint16_t expected16;
+        std::memcpy(&expected16, buffer + offset, sizeof(expected16));
+        EXPECT_EQ(check_env::load_unaligned<uint16_t>(buffer + offset), expected16);
+
+        double expected_double;
+        std::memcpy(&expected_double, buffer + offset, sizeof(expected_double));
+        double loaded = check_env::load_unaligned<double>(buffer + offset);
+        EXPECT_EQ(std::memcmp(&loaded, &expected_double, sizeof(double)), 0);
+    }
+
+    uint8_t out[16] = {};
+    check_env::store_unaligned<uint32_t>(out + 3, 0x11223344u);
+    EXPECT_EQ(check_env::load_unaligned<uint32_t>(out + 3), 0x11223344u);
+    EXPECT_EQ(out[2], 0);
+    EXPECT_EQ(out[7], 0);
+}
+
+// Test the bulk variants
+TEST(CheckEnvTest, LoadStoreUnalignedBulk) {
+    uint32_t values[3] = {1, 0xdeadbeef, 42};
+    uint8_t bytes[1 + sizeof(values)] = {};
+    check_env::store_unaligned_n(bytes + 1, values, 3);
+
+    uint32_t loaded[3] = {};
+    check_env::load_unaligned_n(bytes + 1, loaded, 3);
+    EXPECT_EQ(loaded[1], 0xdeadbeefu);
+    EXPECT_EQ(check_env::load_unaligned<uint32_t>(bytes + 1 + 2 * sizeof(uint32_t)), 42u);
+}
+
+TEST(CheckEnvTest, ParseSysfsValues) {
+    EXPECT_EQ(check_env::detail::parse_size("48K\n"), 48u * 1024);
+    EXPECT_EQ(check_env::detail::parse_size("2048 kB\n"), 2048u * 1024);
+    EXPECT_EQ(check_env::detail::parse_size("32M"), 32u * 1024 * 1024);
+    EXPECT_EQ(check_env::detail::parse_size("2097152\n"), 2097152u);
+    EXPECT_EQ(check_env::detail::parse_size("none"), 0u);
+
+    EXPECT_EQ(check_env::detail::count_cpu_list("0\n"), 1u);
+    EXPECT_EQ(check_env::detail::count_cpu_list("0,64\n"), 2u);
+    EXPECT_EQ(check_env::detail::count_cpu_list("0-3,8,10-11\n"), 7u);
+    EXPECT_EQ(check_env::detail::count_cpu_list(""), 0u);
+}
+
+TEST(CheckEnvTest, SystemTopology) {
+    static_assert((check_env::default_cache_line_size & (check_env::default_cache_line_size - 1)) == 0,
+                  "Cache line size must be a power of two");
+    const check_env::system_topology& t = check_env::topology();
+    EXPECT_EQ(&t, &check_env::topology());
+
+    EXPECT_GE(t.cache_line_size, 16u);
+    EXPECT_EQ(t.cache_line_size & (t.cache_line_size - 1), 0u);
+    EXPECT_GE(t.page_size, 4096u);
+    EXPECT_EQ(t.page_size & (t.page_size - 1), 0u);
+    EXPECT_GE(t.huge_page_size, t.page_size);
+    EXPECT_GE(t.l1d_cache_size, t.cache_line_size);
+    EXPECT_GE(t.l2_cache_size, t.l1d_cache_size);
+    if (t.l3_cache_size != 0) {
+        EXPECT_GE(t.l3_cache_size, t.l2_cache_size);
+    }
+
+    EXPECT_GE(t.physical_cores, 1u);
+    EXPECT_GE(t.smt_width, 1u);
+    EXPECT_EQ(t.physical_cores * t.smt_width, t.logical_cpus);
+    EXPECT_EQ(check_env::worker_thread_count(), t.physical_cores);
+}
+
+TEST(CheckEnvTest, L1BatchSize) {
+    struct Big {
+        char bytes[1 << 20];
+    };
+    std::size_t l1 = check_env::topology().l1d_cache_size;
+    EXPECT_EQ(check_env::l1_batch_size<std::uint64_t>(), l1 / 2 / 8);
+    EXPECT_EQ(check_env::l1_batch_size<std::uint64_t>(4), l1 / 4 / 8);
+    EXPECT_EQ(check_env::l1_batch_size<Big>(), 1u);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "field_diff.h"
+#include "vector_comparator.h"
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+PACKED_RECORD(Instruction, 32, (opcode, 6), (dest, 5), (src, 5), (imm, 16));
+
+PACKED_RECORD(Wide, 64, (low, 64), (tag, 3), (rest, 61));
+
+using HeaderLayout = split_total_seq_helper<16, 4, 12, 16, 16>;
+
+std::vector<Instruction> program(std::size_t n) {
+    std::vector<Instruction> insns(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        insns[i].set_opcode(i % 64);
+        insns[i].set_dest(i % 32);
+        insns[i].set_src((i + 7) % 32);
+        insns[i].set_imm(i * 31);
+    }
+    return insns;
+}
+
+}  // namespace
+
+TEST(FieldDiffTest, LayoutTypes) {
+    static_assert(std::is_same_v<record_layout_t<HeaderLayout>, packed_record<16, 4, 12, 16, 16>>);
+    static_assert(std::is_same_v<record_layout_t<Instruction>, packed_record<32, 6, 5, 5, 16>>);
+    static_assert(field_table<record_layout_t<HeaderLayout>>::record_bytes == 6);
+    static_assert(field_table<record_layout_t<Wide>>::offsets[2] == 67);
+}
+
+TEST(FieldDiffTest, ReportsChangedFields) {
+    std::vector<Instruction> before = program(1000);
+    std::vector<Instruction> after = before;
+    after[3].set_dest(after[3].dest() ^ 0x11);
+    after[3].set_imm(0);
+    after[700].set_opcode(after[700].opcode() ^ 1);
+
+    std::vector<field_difference> diffs =
+        compare_fields<Instruction>(before.data(), after.data(), before.size());
+    ASSERT_EQ(diffs.size(), 3u);
+    EXPECT_EQ(diffs[0], (field_difference{3, 1, before[3].dest(), after[3].dest(), 0x11}));
+    EXPECT_EQ(diffs[1], (field_difference{3, 3, 93, 0, 93}));
+    EXPECT_EQ(diffs[2], (field_difference{700, 0, before[700].opcode(), after[700].opcode(), 1}));
+
+    EXPECT_TRUE(compare_fields<Instruction>(before.data(), before.data(), before.size()).empty());
+    // Only the first count records are compared
+    EXPECT_EQ(compare_fields<Instruction>(before.data(), after.data(), 3).size(), 0u);
+}
+
+TEST(FieldDiffTest, MultiWordLayouts) {
+    std::vector<Wide> before(100);
+    std::vector<Wide> after(100);
+    after[50].set_low(std::uint64_t(1) << 63);
+    after[50].set_rest(6);
+    after[99].set_tag(7);
+    std::vector<field_difference> diffs =
+        compare_fields<Wide>(before.data(), after.data(), before.size());
+    ASSERT_EQ(diffs.size(), 3u);
+    EXPECT_EQ(diffs[0], (field_difference{50, 0, 0, std::uint64_t(1) << 63, std::uint64_t(1) << 63}));
+    EXPECT_EQ(diffs[1], (field_difference{50, 2, 0, 6, 6}));
+    EXPECT_EQ(diffs[2], (field_difference{99, 1, 0, 7, 7}));
+
+    // A split_total_seq_helper layout over unaligned bytes
+    std::vector<std::uint8_t> a(1 + 6 * 20, 0x5a);
+    std::vector<std::uint8_t> b = a;
+    b[1 + 6 * 7 + 1] ^= 0x80;  // flags of record 7, bit 11
+    b[1 + 6 * 19 + 4] ^= 0x01; // checksum of record 19, bit 0
+    diffs = compare_fields<HeaderLayout>(a.data() + 1, b.data() + 1, 20);
+    ASSERT_EQ(diffs.size(), 2u);
+    EXPECT_EQ(diffs[0].record, 7u);
+    EXPECT_EQ(diffs[0].field, 1u);
+    EXPECT_EQ(diffs[0].changed_bits, 0x800u);
+    EXPECT_EQ(diffs[1].record, 19u);
+    EXPECT_EQ(diffs[1].field, 3u);
+    EXPECT_EQ(diffs[1].changed_bits, 1u);
+}
+
+TEST(FieldDiffTest, PrintFieldDifferences) {
+    std::vector<Instruction> before = program(10);
+    std::vector<Instruction> after = before;
+    after[4].set_src(0);
+    const auto* a = reinterpret_cast<const uint8_t*>(before.data());
+    const auto* b = reinterpret_cast<const uint8_t*>(after.data());
+    static const char* const names[] = {"opcode", "dest", "src", "imm"};
+
+    std::ostringstream out;
+    VectorComparator::print_field_differences<Instruction>(a, 40, b, 42, &out, names);
+    EXPECT_NE(out.str().find("1 field differences in 1 of 10 records"), std::string::npos);
+    EXPECT_NE(out.str().find("       4 | src          | 0x000000000000000b | 0x0000000000000000"),
+              std::string::npos);
+
+    std::ostringstream same;
+    VectorComparator::print_field_differences<Instruction>(a, 40, a, 40, &same);
+    EXPECT_EQ(same.str(), "✓ All 10 records are identical\n");
+}
@@ -0,0 +1,40 @@
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "check_env.h"
+
+// Helpers shared by several test files
+
+// n pseudo-random bytes, the same for the same seed
+inline std::vector<std::uint8_t> random_bytes(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<std::uint8_t> bytes(n);
+    for (std::uint8_t& byte : bytes) {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+    return bytes;
+}
+
+// The kernels of set the running CPU can execute, lowest tier first,
+// followed by the scalar reference
+template <typename Fn>
+std::vector<Fn*> runnable_kernels(const check_env::kernel_set<Fn>& set, Fn* scalar) {
+    std::vector<Fn*> kernels;
+    check_env::isa_level best = check_env::best_isa_level();
+    for (check_env::isa_level level :
+         {check_env::isa_level::baseline, check_env::isa_level::sse42, check_env::isa_level::avx2,
+          check_env::isa_level::avx512}) {
+        if (level <= best) {
+            kernels.push_back(check_env::select_kernel(set, level));
+        }
+    }
+    kernels.push_back(scalar);
+    return kernels;
+}
+
+#endif // TEST_HELPERS_H
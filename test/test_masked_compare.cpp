@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "masked_compare.h"
+#include "test_helpers.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Runs of bytes with (a[i] ^ b[i]) & m[i] non-zero
+std::vector<mismatch_range> naive_masked_ranges(const std::vector<std::uint8_t>& a,
+                                                const std::vector<std::uint8_t>& b,
+                                                const std::vector<std::uint8_t>& m) {
+    std::vector<mismatch_range> ranges;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (((a[i] ^ b[i]) & m[i]) == 0) {
+            continue;
+        }
+        if (!ranges.empty() && ranges.back().end() == i) {
+            ++ranges.back().length;
+        } else {
+            ranges.push_back({i, 1});
+        }
+    }
+    return ranges;
+}
+
+struct Snapshots {
+    std::vector<std::uint8_t> a;
+    std::vector<std::uint8_t> b;
+};
+
+// b differs from a in roughly one byte out of 40, in random bits
+Snapshots snapshots(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    Snapshots s;
+    s.a.resize(n);
+    for (std::uint8_t& byte : s.a) {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+    s.b = s.a;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (rng() % 40 == 0) {
+            s.b[i] ^= static_cast<std::uint8_t>(1u << (rng() % 8));
+        }
+    }
+    return s;
+}
+
+}  // namespace
+
+TEST(MaskedCompareTest, KernelsAgreeWithScalar) {
+    Snapshots s = snapshots(1024 + 8, 3);
+    std::mt19937 rng(5);
+    std::vector<std::uint8_t> m(s.a.size());
+    for (std::uint8_t& byte : m) {
+        byte = static_cast<std::uint8_t>(rng() & rng());
+    }
+    for (masked_mismatch_block_fn* kernel :
+         runnable_kernels(masked_mismatch_block_kernels(), &masked_mismatch_block_scalar)) {
+        for (std::size_t offset = 0; offset < 8; ++offset) {
+            for (std::size_t n : {0u, 1u, 63u, 64u, 65u, 127u, 200u, 1024u}) {
+                const std::uint8_t* a = s.a.data() + offset;
+                const std::uint8_t* b = s.b.data() + offset;
+                const std::uint8_t* mm = m.data() + offset;
+                std::uint64_t expected = 0;
+                std::size_t block = 0;
+                for (; block < n; block += 64) {
+                    expected = masked_mismatch_mask_scalar(a + block, b + block, mm + block,
+                                                           std::min<std::size_t>(64, n - block));
+                    if (expected != 0) {
+                        break;
+                    }
+                }
+                std::uint64_t mask = 1;
+                EXPECT_EQ(kernel(a, b, mm, n, &mask), std::min(block, n)) << "n=" << n;
+                EXPECT_EQ(mask, expected);
+            }
+        }
+    }
+}
+
+TEST(MaskedCompareTest, PerByteMask) {
+    Snapshots s = snapshots(5000, 7);
+    std::vector<std::uint8_t> m(s.a.size(), 0xff);
+    // Ignore the low nibble everywhere and bytes 100-199 entirely
+    for (std::size_t i = 0; i < m.size(); ++i) {
+        m[i] = i >= 100 && i < 200 ? 0 : 0xf0;
+    }
+    EXPECT_EQ(compare_masked(s.a.data(), s.b.data(), s.a.size(), m.data()),
+              naive_masked_ranges(s.a, s.b, m));
+
+    std::vector<std::uint8_t> all(s.a.size(), 0xff);
+    EXPECT_EQ(compare_masked(s.a.data(), s.b.data(), s.a.size(), all.data()).size(),
+              compare_masked(s.a.data(), s.b.data(), s.a.size(), std::vector<mismatch_range>{})
+                  .size());
+    std::vector<std::uint8_t> none(s.a.size(), 0);
+    EXPECT_EQ(count_masked_mismatches(s.a.data(), s.b.data(), s.a.size(), none.data()), 0u);
+}
+
+TEST(MaskedCompareTest, RepeatingMask) {
+    // A 24-byte record: 8-byte timestamp, 4-byte sequence number, a reserved
+    // top bit in the next byte, then payload
+    std::vector<std::uint8_t> record(24, 0xff);
+    std::fill(record.begin(), record.begin() + 12, 0);
+    record[12] = 0x7f;
+
+    for (std::size_t n : {0u, 23u, 24u, 1000u, 30000u}) {
+        for (std::size_t phase : {0u, 5u}) {
+            Snapshots s = snapshots(n, static_cast<unsigned>(n + phase));
+            std::vector<std::uint8_t> m(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                m[i] = record[(phase + i) % record.size()];
+            }
+            EXPECT_EQ(compare_masked(s.a.data(), s.b.data(), n,
+                                     repeating_mask{record.data(), record.size(), phase}),
+                      naive_masked_ranges(s.a, s.b, m))
+                << "n=" << n << " phase=" << phase;
+        }
+    }
+
+    // Runs that cross a tile boundary are reported once
+    std::vector<std::uint8_t> ones(1);
+    ones[0] = 0xff;
+    std::vector<std::uint8_t> a(20000, 0);
+    std::vector<std::uint8_t> b(20000, 0);
+    std::fill(b.begin() + 8000, b.begin() + 9000, 1);
+    EXPECT_EQ(compare_masked(a.data(), b.data(), a.size(), repeating_mask{ones.data(), 1}),
+              (std::vector<mismatch_range>{{8000, 1000}}));
+}
+
+TEST(MaskedCompareTest, IgnoredRanges) {
+    Snapshots s = snapshots(3000, 9);
+    std::vector<mismatch_range> ignored = {{2900, 500}, {10, 90}, {50, 100}, {1000, 0}, {400, 1}};
+    std::vector<std::uint8_t> m(s.a.size(), 0xff);
+    for (const mismatch_range& r : ignored) {
+        for (std::size_t i = r.offset; i < std::min(r.end(), m.size()); ++i) {
+            m[i] = 0;
+        }
+    }
+    EXPECT_EQ(compare_masked(s.a.data(), s.b.data(), s.a.size(), ignored),
+              naive_masked_ranges(s.a, s.b, m));
+
+    // A run split only by an empty ignored range stays whole
+    std::vector<std::uint8_t> a(100, 0);
+    std::vector<std::uint8_t> b(100, 1);
+    EXPECT_EQ(compare_masked(a.data(), b.data(), 100, std::vector<mismatch_range>{{40, 0}}),
+              (std::vector<mismatch_range>{{0, 100}}));
+    EXPECT_EQ(count_masked_mismatches(a.data(), b.data(), 100,
+                                      std::vector<mismatch_range>{{40, 20}, {90, 50}}),
+              70u);
+}
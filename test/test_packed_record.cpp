@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "packed_record.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+
+PACKED_RECORD(Instruction, 32, (opcode, 6), (dest, 5), (src, 5), (imm, 16));
+
+PACKED_RECORD(Header, 16, (version, 4), (flags, 12), (length, 16), (checksum, 16));
+
+PACKED_RECORD(Wide, 64, (low, 64), (tag, 3), (rest, 61));
+
+}  // namespace
+
+TEST(PackedRecordTest, Layout) {
+    static_assert(sizeof(Instruction) == 4);
+    static_assert(std::is_trivially_copyable_v<Instruction>);
+    static_assert(std::is_same_v<Instruction::word_type, std::uint32_t>);
+    static_assert(Instruction::offset<3> == 16);
+    static_assert(Instruction::mask<1> == 0x1f);
+    static_assert(Header::word_count == 3);
+    static_assert(Header::offset<3> == 32);
+    static_assert(Wide::mask<0> == ~std::uint64_t(0));
+    static_assert(!is_word_size_aligned<32, 30, 4, 30>);
+}
+
+TEST(PackedRecordTest, GettersAndSetters) {
+    Instruction insn{};
+    insn.set_opcode(0x2a);
+    insn.set_dest(3);
+    insn.set_src(31);
+    insn.set_imm(0xbeef);
+    EXPECT_EQ(insn.opcode(), 0x2au);
+    EXPECT_EQ(insn.dest(), 3u);
+    EXPECT_EQ(insn.src(), 31u);
+    EXPECT_EQ(insn.imm(), 0xbeefu);
+    EXPECT_EQ(insn.words[0], 0xbeefu << 16 | 31u << 11 | 3u << 6 | 0x2au);
+
+    // Out-of-range values are truncated to the field
+    insn.set_dest(0xff);
+    EXPECT_EQ(insn.dest(), 0x1fu);
+    EXPECT_EQ(insn.src(), 31u);
+    EXPECT_EQ(insn.opcode(), 0x2au);
+}
+
+TEST(PackedRecordTest, MultipleWords) {
+    Header header{};
+    header.set_version(2);
+    header.set_flags(0xabc);
+    header.set_length(1500);
+    header.set_checksum(0xffff);
+    EXPECT_EQ(header.words[0], 0xabc2u);
+    EXPECT_EQ(header.words[1], 1500u);
+    EXPECT_EQ(header.words[2], 0xffffu);
+    EXPECT_EQ(header.version(), 2u);
+    EXPECT_EQ(header.flags(), 0xabcu);
+
+    Wide wide{};
+    wide.set_low(~std::uint64_t(0));
+    wide.set_tag(5);
+    wide.set_rest(std::uint64_t(1) << 60);
+    EXPECT_EQ(wide.low(), ~std::uint64_t(0));
+    EXPECT_EQ(wide.tag(), 5u);
+    EXPECT_EQ(wide.rest(), std::uint64_t(1) << 60);
+}
+
+TEST(PackedRecordTest, Constexpr) {
+    constexpr Instruction insn = [] {
+        Instruction i{};
+        i.set_imm(7);
+        i.set_opcode(1);
+        return i;
+    }();
+    static_assert(insn.imm() == 7);
+    static_assert(insn.opcode() == 1);
+    static_assert(insn.get<2>() == 0);
+}
+
+TEST(PackedRecordTest, LoadStoreAtAnyOffset) {
+    Header header{};
+    header.set_version(3);
+    header.set_length(0x1234);
+    header.set_checksum(0xbeef);
+
+    unsigned char buffer[1 + sizeof(Header)] = {};
+    header.store(buffer + 1);
+
+    Header copy{};
+    copy.load(buffer + 1);
+    EXPECT_EQ(copy.version(), 3u);
+    EXPECT_EQ(copy.length(), 0x1234u);
+    EXPECT_EQ(copy.checksum(), 0xbeefu);
+}
+
+TEST(PackedRecordTest, DecodeBatchSize) {
+    std::size_t batch = Header::decode_batch_size();
+    EXPECT_GE(batch, 1u);
+    EXPECT_LE(batch * sizeof(Header), check_env::topology().l1d_cache_size / 4);
+}
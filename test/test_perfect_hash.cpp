@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "perfect_hash.h"
+#include "type_map.h"
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace tmpl_lib;
+
+namespace {
+
+constexpr auto fields = make_perfect_hash({"id", "length", "payload", "checksum", "flags"});
+
+// 1,200 distinct names, field0000 .. field1199
+constexpr std::size_t name_count = 1200;
+
+struct Names {
+    char text[name_count][10];
+};
+
+constexpr Names make_names() {
+    Names names{};
+    for (std::size_t i = 0; i < name_count; ++i) {
+        const char prefix[] = "field";
+        for (std::size_t c = 0; c < 5; ++c) {
+            names.text[i][c] = prefix[c];
+        }
+        names.text[i][5] = static_cast<char>('0' + i / 1000);
+        names.text[i][6] = static_cast<char>('0' + i / 100 % 10);
+        names.text[i][7] = static_cast<char>('0' + i / 10 % 10);
+        names.text[i][8] = static_cast<char>('0' + i % 10);
+    }
+    return names;
+}
+
+constexpr Names names = make_names();
+
+constexpr perfect_hash<name_count> make_catalog() {
+    std::string_view keys[name_count] = {};
+    for (std::size_t i = 0; i < name_count; ++i) {
+        keys[i] = std::string_view(names.text[i], 9);
+    }
+    return perfect_hash<name_count>(keys);
+}
+
+constexpr auto catalog = make_catalog();
+
+}  // namespace
+
+TEST(PerfectHashTest, FindsEveryKey) {
+    static_assert(fields.find("id") == 0);
+    static_assert(fields.find("flags") == 4);
+    static_assert(fields.key(2) == "payload");
+    EXPECT_EQ(fields.find(std::string("checksum")), 3u);
+    EXPECT_TRUE(fields.contains("length"));
+}
+
+TEST(PerfectHashTest, RejectsOtherStrings) {
+    static_assert(fields.find("") == fields.size);
+    EXPECT_EQ(fields.find("ID"), fields.size);
+    EXPECT_EQ(fields.find("payloads"), fields.size);
+    EXPECT_FALSE(fields.contains("flag"));
+}
+
+TEST(PerfectHashTest, RejectsDuplicateKeysAtRuntime) {
+    std::string first = "length";
+    std::string second = "length";
+    const std::string_view keys[] = {"id", first, "payload", second};
+    EXPECT_THROW(perfect_hash<4>{keys}, std::invalid_argument);
+
+    second = "flags";
+    const std::string_view distinct[] = {"id", first, "payload", second};
+    EXPECT_EQ(perfect_hash<4>(distinct).find("flags"), 3u);
+}
+
+TEST(PerfectHashTest, LargeKeySet) {
+    static_assert(catalog.find("field0000") == 0);
+    static_assert(catalog.find("field1199") == 1199);
+    std::size_t misses = 0;
+    for (std::size_t i = 0; i < name_count; ++i) {
+        misses += catalog.find(std::string_view(names.text[i], 9)) != i;
+    }
+    EXPECT_EQ(misses, 0u);
+    EXPECT_EQ(catalog.find("field1200"), name_count);
+    EXPECT_EQ(catalog.find("field"), name_count);
+}
+
+TEST(PerfectHashTest, TypeIdFromName) {
+    static_assert(my_type_names.size == MyTypeRegistry::size);
+    static_assert(type_id_from_name("TypeA") == TypeId::TypeA);
+    static_assert(type_id_from_name("TypeB") == type_to_id_v<TypeB>);
+    static_assert(my_type_names.key(2) == TypeC::name);
+    EXPECT_EQ(type_id_from_name("TypeC"), TypeId{2});
+    EXPECT_EQ(type_id_from_name("TypeD"), MyTypeRegistry::count);
+}
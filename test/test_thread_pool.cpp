@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "thread_pool.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, Size) {
+    EXPECT_EQ(thread_pool(1).size(), 1u);
+    EXPECT_EQ(thread_pool(4).size(), 4u);
+    EXPECT_EQ(thread_pool::shared().size(), check_env::worker_thread_count());
+}
+
+TEST(ThreadPoolTest, EveryIndexRunsOnce) {
+    for (unsigned threads : {1u, 3u, 8u}) {
+        thread_pool pool(threads);
+        for (std::size_t count : {0u, 1u, 7u, 1000u}) {
+            std::vector<std::atomic<int>> hits(count);
+            pool.parallel_for(count, [&](std::size_t i) { hits[i].fetch_add(1); });
+            for (std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(hits[i].load(), 1) << "threads " << threads << " index " << i;
+            }
+        }
+    }
+}
+
+TEST(ThreadPoolTest, ManyLoops) {
+    thread_pool pool(4);
+    std::atomic<std::size_t> sum{0};
+    for (int loop = 0; loop < 200; ++loop) {
+        pool.parallel_for(10, [&](std::size_t i) { sum.fetch_add(i); });
+    }
+    EXPECT_EQ(sum.load(), 200u * 45);
+}
+
+TEST(ThreadPoolTest, ExceptionStopsTheLoop) {
+    thread_pool pool(4);
+    std::atomic<std::size_t> ran{0};
+    EXPECT_THROW(pool.parallel_for(100000,
+                                   [&](std::size_t i) {
+                                       ran.fetch_add(1);
+                                       if (i == 10) {
+                                           throw std::runtime_error("stop");
+                                       }
+                                   }),
+                 std::runtime_error);
+    EXPECT_LT(ran.load(), 100000u);
+
+    // The pool is still usable
+    std::atomic<std::size_t> count{0};
+    pool.parallel_for(50, [&](std::size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 50u);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "type_dispatch.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace tmpl_lib;
+
+namespace {
+
+template <std::size_t I>
+struct Message {
+    static constexpr std::size_t id = I;
+};
+
+template <typename Indices>
+struct make_messages;
+
+template <std::size_t... Is>
+struct make_messages<std::index_sequence<Is...>> {
+    using type = type_list<Message<Is>...>;
+};
+
+using Messages = make_messages<std::make_index_sequence<1200>>::type;
+using MessageRegistry = type_registry<Messages>;
+
+template <typename T>
+std::string name_of() {
+    if constexpr (std::is_same_v<T, TypeA>) {
+        return "A";
+    } else if constexpr (std::is_same_v<T, TypeB>) {
+        return "B";
+    } else {
+        return "C";
+    }
+}
+
+}  // namespace
+
+TEST(TypeDispatchTest, CallsTheHandlerForTheId) {
+    auto name = [](auto tag) { return name_of<typename decltype(tag)::type>(); };
+    EXPECT_EQ(dispatch(type_to_id_v<TypeA>, name), "A");
+    EXPECT_EQ(dispatch(type_to_id_v<TypeB>, name), "B");
+    EXPECT_EQ(dispatch(TypeId{2}, name), "C");
+}
+
+TEST(TypeDispatchTest, ForwardsArguments) {
+    int calls = 0;
+    auto count = [](auto tag, int& counter, int step) {
+        counter += step;
+        return sizeof(typename decltype(tag)::type);
+    };
+    EXPECT_EQ(dispatch(TypeId{1}, count, calls, 3), sizeof(TypeB));
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(TypeDispatchTest, LargeRegistry) {
+    auto id_of = [](auto tag) { return decltype(tag)::type::id; };
+    for (std::size_t i : {0u, 1u, 599u, 1199u}) {
+        EXPECT_EQ(dispatch<MessageRegistry>(i, id_of), i);
+    }
+}
+
+TEST(TypeDispatchTest, BatchGroupsByType) {
+    std::vector<std::pair<TypeId, int>> items = {
+        {TypeId{2}, 0}, {TypeId{0}, 1}, {TypeId{2}, 2}, {TypeId{1}, 3}, {TypeId{0}, 4}};
+    std::string order;
+    std::vector<int> payloads;
+    dispatch_batch(items.begin(), items.end(), [&](auto tag, int payload) {
+        order += name_of<typename decltype(tag)::type>();
+        payloads.push_back(payload);
+    });
+    EXPECT_EQ(order, "AABCC");
+    EXPECT_EQ(payloads, (std::vector<int>{1, 4, 3, 0, 2}));
+}
+
+TEST(TypeDispatchTest, BatchLargeRegistry) {
+    std::vector<std::pair<std::size_t, std::size_t>> items;
+    for (std::size_t i = 0; i < 3000; ++i) {
+        items.emplace_back(i * 7 % 1200, i);
+    }
+    std::size_t mismatches = 0;
+    std::size_t visited = 0;
+    dispatch_batch<MessageRegistry>(items.begin(), items.end(), [&](auto tag, std::size_t i) {
+        mismatches += decltype(tag)::type::id != i * 7 % 1200;
+        ++visited;
+    });
+    EXPECT_EQ(mismatches, 0u);
+    EXPECT_EQ(visited, items.size());
+}
+
+TEST(TypeDispatchTest, BatchEmpty) {
+    std::vector<std::pair<TypeId, int>> items;
+    int calls = 0;
+    dispatch_batch(items.begin(), items.end(), [&](auto, int) { ++calls; });
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(TypeDispatchTest, VisitAtTypeList) {
+    using Sizes = type_list<char, std::int32_t, double, Message<7>>;
+    auto size_of = [](auto tag) { return sizeof(typename decltype(tag)::type); };
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < Sizes::size; ++i) {
+        total += visit_at<Sizes>(i, size_of);
+    }
+    EXPECT_EQ(total, sizeof(char) + sizeof(std::int32_t) + sizeof(double) + sizeof(Message<7>));
+    EXPECT_EQ(visit_at<Messages>(1000, [](auto tag) { return decltype(tag)::type::id; }), 1000u);
+}
+
+TEST(TypeDispatchTest, RejectsOutOfRangeIds) {
+    int calls = 0;
+    auto count = [&](auto) { return ++calls; };
+    EXPECT_THROW(dispatch(MyTypeRegistry::count, count), std::out_of_range);
+    EXPECT_THROW(dispatch(type_id_from_name("TypeD"), count), std::out_of_range);
+    EXPECT_THROW(dispatch<MessageRegistry>(1200, count), std::out_of_range);
+    using Pair = type_list<char, int>;
+    EXPECT_THROW(visit_at<Pair>(~std::size_t{0}, count), std::out_of_range);
+    EXPECT_EQ(calls, 0);
+
+    // One bad item rejects the whole batch before any handler runs
+    std::vector<std::pair<TypeId, int>> items = {
+        {TypeId{0}, 0}, {TypeId{1}, 1}, {static_cast<TypeId>(1000), 2}, {TypeId{2}, 3}};
+    EXPECT_THROW(dispatch_batch(items.begin(), items.end(), [&](auto, int) { ++calls; }),
+                 std::out_of_range);
+    EXPECT_EQ(calls, 0);
+}
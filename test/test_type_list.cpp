@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "type_list.h"
+#include "type_map.h"
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace tmpl_lib;
+
+namespace {
+
+struct Empty {};
+struct alignas(16) Wide {
+    char bytes[32];
+};
+
+using Mixed = type_list<int, double, char, int, Empty, double, Wide>;
+
+// A list long enough to need several tree levels
+template <std::size_t I>
+struct Tag {
+    char bytes[I % 7 + 1];
+};
+
+template <typename Indices>
+struct make_tags;
+
+template <std::size_t... Is>
+struct make_tags<std::index_sequence<Is...>> {
+    using type = type_list<Tag<Is>...>;
+    using repeated = type_list<Tag<Is % 100>...>;
+};
+
+using Long = make_tags<std::make_index_sequence<1000>>::type;
+
+template <typename T>
+struct is_wide : std::bool_constant<(sizeof(T) >= 7)> {};
+
+}  // namespace
+
+TEST(TypeListTest, At) {
+    static_assert(std::is_same_v<at_t<0, Mixed>, int>);
+    static_assert(std::is_same_v<at_t<4, Mixed>, Empty>);
+    static_assert(std::is_same_v<at_t<6, Mixed>, Wide>);
+    static_assert(std::is_same_v<at_t<0, Long>, Tag<0>>);
+    static_assert(std::is_same_v<at_t<517, Long>, Tag<517>>);
+    static_assert(std::is_same_v<at_t<999, Long>, Tag<999>>);
+    static_assert(std::is_same_v<at_t<1, MyTypeList>, TypeB>);
+    EXPECT_EQ(Mixed::size, 7u);
+    EXPECT_EQ(Long::size, 1000u);
+}
+
+TEST(TypeListTest, IndexOf) {
+    static_assert(index_of_v<double, Mixed> == 1);
+    static_assert(index_of_v<Wide, Mixed> == 6);
+    static_assert(index_of_v<float, Mixed> == Mixed::size);
+    static_assert(index_of_v<Tag<765>, Long> == 765);
+    static_assert(contains_v<Empty, Mixed>);
+    static_assert(!contains_v<float, Mixed>);
+    static_assert(!contains_v<int, type_list<>>);
+    EXPECT_EQ((index_of_v<char, Mixed>), 2u);
+}
+
+TEST(TypeListTest, Concat) {
+    static_assert(std::is_same_v<concat_t<>, type_list<>>);
+    static_assert(std::is_same_v<concat_t<Mixed>, Mixed>);
+    static_assert(std::is_same_v<concat_t<type_list<int>, type_list<>, type_list<char, Empty>>,
+                                 type_list<int, char, Empty>>);
+    static_assert(
+        std::is_same_v<concat_t<type_list<int>, type_list<char>, type_list<float>,
+                                type_list<double>, type_list<Empty>, type_list<Wide>>,
+                       type_list<int, char, float, double, Empty, Wide>>);
+    using Twice = concat_t<Long, Long>;
+    static_assert(Twice::size == 2000);
+    static_assert(std::is_same_v<at_t<1500, Twice>, Tag<500>>);
+}
+
+TEST(TypeListTest, Filter) {
+    static_assert(std::is_same_v<filter_t<Mixed, std::is_integral>, type_list<int, char, int>>);
+    static_assert(std::is_same_v<filter_t<Mixed, std::is_pointer>, type_list<>>);
+    static_assert(std::is_same_v<filter_t<type_list<>, std::is_integral>, type_list<>>);
+    using WideTags = filter_t<Long, is_wide>;
+    // Sizes 1..7 repeat every seven tags; only size 7 (I % 7 == 6) passes
+    static_assert(WideTags::size == 142);
+    static_assert(std::is_same_v<at_t<0, WideTags>, Tag<6>>);
+    static_assert(std::is_same_v<at_t<141, WideTags>, Tag<993>>);
+}
+
+TEST(TypeListTest, SortBy) {
+    // Largest first, stable among equal keys
+    static_assert(std::is_same_v<sort_by_size_t<Mixed>,
+                                 type_list<Wide, double, double, int, int, char, Empty>>);
+    static_assert(std::is_same_v<sort_by_alignment_t<Mixed>,
+                                 type_list<Wide, double, double, int, int, char, Empty>>);
+    static_assert(std::is_same_v<sort_by_t<Mixed, size_key>,
+                                 type_list<char, Empty, int, int, double, double, Wide>>);
+    static_assert(std::is_same_v<sort_by_size_t<type_list<>>, type_list<>>);
+
+    using Sorted = sort_by_size_t<Long>;
+    static_assert(Sorted::size == Long::size);
+    static_assert(std::is_same_v<at_t<0, Sorted>, Tag<6>>);
+    static_assert(std::is_same_v<at_t<1, Sorted>, Tag<13>>);
+    static_assert(std::is_same_v<at_t<999, Sorted>, Tag<994>>);
+}
+
+TEST(TypeListTest, Unique) {
+    static_assert(std::is_same_v<unique_t<Mixed>, type_list<int, double, char, Empty, Wide>>);
+    static_assert(std::is_same_v<unique_t<type_list<>>, type_list<>>);
+    static_assert(std::is_same_v<unique_t<type_list<int, int, int>>, type_list<int>>);
+
+    using Repeated = make_tags<std::make_index_sequence<1000>>::repeated;
+    using Deduplicated = unique_t<Repeated>;
+    static_assert(Deduplicated::size == 100);
+    static_assert(std::is_same_v<at_t<42, Deduplicated>, Tag<42>>);
+}
+
+TEST(TypeListTest, UniqueDistinguishesTypesThatPrintAlike) {
+    // Unnamed types can share a spelling, so they share a hash bucket
+    auto first = [] {};
+    auto second = [] {};
+    using First = decltype(first);
+    using Second = decltype(second);
+    static_assert(!std::is_same_v<First, Second>);
+    static_assert(std::is_same_v<unique_t<type_list<First, Second, First, Second>>,
+                                 type_list<First, Second>>);
+    EXPECT_EQ((unique_t<type_list<First, int, Second, int>>::size), 3u);
+}
+
+TEST(TypeRegistryTest, MyTypeList) {
+    static_assert(type_to_id_v<TypeA> == TypeId{0});
+    static_assert(type_to_id_v<TypeC> == TypeId{2});
+    static_assert(std::is_same_v<id_to_type_t<TypeId{1}>, TypeB>);
+    static_assert(MyTypeRegistry::count == TypeId{3});
+    static_assert(type_to_id_v<TypeB> == TypeId::TypeB);
+    static_assert(std::is_same_v<id_to_type_t<TypeId::TypeC>, TypeC>);
+    static_assert(MyTypeRegistry::count == TypeId::Count);
+    EXPECT_TRUE(MyTypeRegistry::contains(TypeId{2}));
+    EXPECT_FALSE(MyTypeRegistry::contains(MyTypeRegistry::count));
+}
+
+TEST(TypeRegistryTest, RoundTripsALongList) {
+    using Registry = type_registry<Long>;
+    static_assert(Registry::size == 1000);
+    static_assert(Registry::type_to_id<Tag<0>>::value == 0);
+    static_assert(Registry::type_to_id<Tag<777>>::value == 777);
+    static_assert(std::is_same_v<Registry::id_to_type<999>::type, Tag<999>>);
+    static_assert(Registry::type_to_id<Registry::id_to_type<531>::type>::value == 531);
+}
+
+TEST(TypeRegistryTest, TypesThatPrintAlike) {
+    auto first = [] {};
+    auto second = [] {};
+    using Registry = type_registry<type_list<int, decltype(first), decltype(second)>>;
+    static_assert(Registry::type_to_id<decltype(first)>::value == 1);
+    static_assert(Registry::type_to_id<decltype(second)>::value == 2);
+    EXPECT_EQ(Registry::type_to_id<int>::value, 0u);
+}
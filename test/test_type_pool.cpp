@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "type_pool.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tmpl_lib;
+
+namespace {
+
+struct alignas(64) Aligned {
+    char bytes[3];
+};
+
+struct Counted {
+    static int live;
+    std::string text;
+    explicit Counted(std::string t) : text(std::move(t)) { ++live; }
+    ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+
+}  // namespace
+
+TEST(TypePoolTest, SlotLayout) {
+    static_assert(slab_pool<char>::slot_size == sizeof(void*));
+    static_assert(slab_pool<Aligned>::slot_size == 64);
+    static_assert(slab_pool<Aligned>::slot_align == 64);
+    static_assert(slab_pool<Aligned>::cache_capacity == 256);
+}
+
+TEST(TypePoolTest, ReusesFreedSlots) {
+    void* first = slab_pool<double>::allocate();
+    slab_pool<double>::deallocate(first);
+    EXPECT_EQ(slab_pool<double>::allocate(), first);
+    slab_pool<double>::deallocate(first);
+}
+
+TEST(TypePoolTest, DistinctAlignedSlotsAcrossSlabs) {
+    std::vector<void*> slots;
+    std::set<void*> unique;
+    for (std::size_t i = 0; i < 3 * slab_pool<Aligned>::cache_capacity + 5; ++i) {
+        void* p = slab_pool<Aligned>::allocate();
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(Aligned), 0u);
+        slots.push_back(p);
+        unique.insert(p);
+    }
+    EXPECT_EQ(unique.size(), slots.size());
+    for (void* p : slots) {
+        slab_pool<Aligned>::deallocate(p);
+    }
+}
+
+TEST(TypePoolTest, NewAndDelete) {
+    Counted* c = pool_new<Counted>("message");
+    EXPECT_EQ(c->text, "message");
+    EXPECT_EQ(Counted::live, 1);
+    pool_delete(c);
+    EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(TypePoolTest, RuntimeTypeId) {
+    void* a = pool_allocate(type_to_id_v<TypeA>);
+    void* c = pool_allocate(type_to_id_v<TypeC>);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(type_pool<MyTypeRegistry>::slot_size(TypeId{1}), slab_pool<TypeB>::slot_size);
+    pool_deallocate(type_to_id_v<TypeA>, a);
+    pool_deallocate(type_to_id_v<TypeC>, c);
+    EXPECT_EQ(slab_pool<TypeA>::allocate(), a);
+    slab_pool<TypeA>::deallocate(a);
+}
+
+TEST(TypePoolTest, RejectsUnknownTypeId) {
+    EXPECT_THROW(pool_allocate(MyTypeRegistry::count), std::out_of_range);
+    EXPECT_THROW(type_pool<MyTypeRegistry>::slot_size(type_id_from_name("TypeD")),
+                 std::out_of_range);
+
+    // The slot stays with the caller, who can still free it under its own id
+    void* b = pool_allocate(type_to_id_v<TypeB>);
+    EXPECT_THROW(pool_deallocate(static_cast<TypeId>(1000), b), std::out_of_range);
+    pool_deallocate(type_to_id_v<TypeB>, b);
+    EXPECT_EQ(slab_pool<TypeB>::allocate(), b);
+    slab_pool<TypeB>::deallocate(b);
+}
+
+TEST(TypePoolTest, FreeOnAnotherThread) {
+    constexpr std::size_t per_thread = 5000;
+    std::vector<std::vector<long*>> handoff(4);
+    std::vector<std::thread> producers;
+    for (std::size_t t = 0; t < handoff.size(); ++t) {
+        producers.emplace_back([&, t] {
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                handoff[t].push_back(pool_new<long>(static_cast<long>(t * per_thread + i)));
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    std::set<long*> unique;
+    std::atomic<std::size_t> wrong{0};
+    std::vector<std::thread> consumers;
+    for (std::size_t t = 0; t < handoff.size(); ++t) {
+        for (long* p : handoff[t]) {
+            unique.insert(p);
+        }
+        consumers.emplace_back([&, t] {
+            std::size_t owner = (t + 1) % handoff.size();
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                if (*handoff[owner][i] != static_cast<long>(owner * per_thread + i)) {
+                    ++wrong;
+                }
+            }
+            for (long* p : handoff[owner]) {
+                pool_delete(p);
+            }
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                pool_delete(pool_new<long>(0));
+            }
+        });
+    }
+    for (std::thread& consumer : consumers) {
+        consumer.join();
+    }
+    EXPECT_EQ(unique.size(), handoff.size() * per_thread);
+    EXPECT_EQ(wrong, 0u);
+}
@@ -2,6 +2,10 @@
 #include "type_value.h"
 #include <type_traits>
 #include <string>
+#include <memory_resource>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
 TEST(TypeValueTest, IndexWrapperBasicUsage) {
     // Test basic TypeValue creation and usage
@@ -199,3 +203,282 @@ TEST(OutputIndicesWrapperTest, GetValueAtFunction) {
     EXPECT_EQ(Wrapper::get_value_at<3>(), 400);
     EXPECT_EQ(Wrapper::size(), 4);
 }
+
+TEST(OutputIndicesWrapperTest, ValueAtRuntimeIndex) {
+    using Wrapper = OutputIndicesWrapper<100, 200, 300, 400>;
+    static_assert(Wrapper::value_at(2) == 300);
+
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < Wrapper::size(); ++i) {
+        sum += Wrapper::value_at(i);
+    }
+    EXPECT_EQ(sum, 1000u);
+    EXPECT_THROW(Wrapper::value_at(4), std::out_of_range);
+
+    using Container = Wrapper::TypeValueContainer<IndexWrapper<0>::TypeValue<int, 1>>;
+    EXPECT_EQ(Container::output_index_at(3), 400u);
+    EXPECT_THROW(Container::output_index_at(4), std::out_of_range);
+}
+
+TEST(TypeValueContainerTest, VisitAtRuntimeIndex) {
+    using Container = OutputIndicesWrapper<7>::TypeValueContainer<
+        IndexWrapper<0>::TypeValue<int, 1>, IndexWrapper<1>::TypeValue<std::string, 2>,
+        IndexWrapper<2>::TypeValue<double, 3>>;
+    Container container(IndexWrapper<0>::TypeValue<int, 1>(4),
+                        IndexWrapper<1>::TypeValue<std::string, 2>(std::string("hello")),
+                        IndexWrapper<2>::TypeValue<double, 3>(2.5));
+
+    auto size_of = [](const auto& value) { return sizeof(value); };
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < Container::value_count(); ++i) {
+        total += visit_at(container, i, size_of);
+    }
+    EXPECT_EQ(total, sizeof(int) + sizeof(std::string) + sizeof(double));
+
+    visit_at(container, 1, [](auto& value, auto index, auto) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::string>) {
+            value += std::to_string(decltype(index)::value);
+        }
+    });
+    EXPECT_EQ(container.get<1>().value, "hello1");
+
+    const Container& view = container;
+    EXPECT_EQ(visit_at(view, 0, [](const auto& value) { return sizeof(value); }), sizeof(int));
+    EXPECT_THROW(visit_at(view, Container::value_count(), size_of), std::out_of_range);
+}
+
+TEST(PackedTypeValueContainerTest, ReordersBasesToRemovePadding) {
+    using CharValue1 = IndexWrapper<0>::TypeValue<char, 1>;
+    using DoubleValue1 = IndexWrapper<1>::TypeValue<double, 2>;
+    using CharValue2 = IndexWrapper<2>::TypeValue<char, 3>;
+    using DoubleValue2 = IndexWrapper<3>::TypeValue<double, 4>;
+
+    using Naive = OutputIndicesWrapper<1, 2, 3, 4>::TypeValueContainer<
+        CharValue1, DoubleValue1, CharValue2, DoubleValue2>;
+    using Packed = OutputIndicesWrapper<1, 2, 3, 4>::PackedTypeValueContainer<
+        CharValue1, DoubleValue1, CharValue2, DoubleValue2>;
+
+    // Doubles first (in declaration order), then the chars
+    static_assert(Packed::storage_order[0] == 1 && Packed::storage_order[1] == 3);
+    static_assert(Packed::storage_order[2] == 0 && Packed::storage_order[3] == 2);
+    static_assert(Naive::storage_order[0] == 0 && Naive::storage_order[3] == 3);
+
+    static_assert(Naive::bytes_saved == 0);
+    static_assert(Packed::declaration_order_size == sizeof(Naive));
+    static_assert(Packed::storage_size == sizeof(Packed));
+    static_assert(sizeof(Packed) < sizeof(Naive));
+    static_assert(Packed::bytes_saved == sizeof(Naive) - sizeof(Packed));
+
+    Packed container(CharValue1('a'), DoubleValue1(1.5), CharValue2('b'), DoubleValue2(2.5));
+
+    // get<Index>() keeps resolving the declaration order
+    EXPECT_EQ(container.get<0>().value, 'a');
+    EXPECT_DOUBLE_EQ(container.get<1>().value, 1.5);
+    EXPECT_EQ(container.get<2>().value, 'b');
+    EXPECT_DOUBLE_EQ(container.get<3>().value, 2.5);
+    EXPECT_EQ(container.get<3>().index, 3);
+
+    container.get<2>().value = 'z';
+    const auto& const_container = container;
+    EXPECT_EQ(const_container.get<2>().value, 'z');
+    static_assert(Packed::get_output_index_at<3>() == 4);
+}
+
+TEST(PackedTypeValueContainerTest, MixedWithString) {
+    using CharValue = IndexWrapper<0>::TypeValue<char, 1>;
+    using StringValue = IndexWrapper<1>::TypeValue<std::string, 2>;
+    using ShortValue = IndexWrapper<2>::TypeValue<short, 3>;
+    using DoubleValue = IndexWrapper<3>::TypeValue<double, 4>;
+
+    using Packed = OutputIndicesWrapper<1, 2, 3, 4>::PackedTypeValueContainer<
+        CharValue, StringValue, ShortValue, DoubleValue>;
+
+    static_assert(Packed::bytes_saved > 0);
+
+    Packed container(CharValue('x'), StringValue(std::string("payload")), ShortValue(7),
+                     DoubleValue(0.25));
+    EXPECT_EQ(container.get<0>().value, 'x');
+    EXPECT_EQ(container.get<1>().value, "payload");
+    EXPECT_EQ(container.get<2>().value, 7);
+    EXPECT_DOUBLE_EQ(container.get<3>().value, 0.25);
+}
+
+// Neither copyable nor movable: can only be built in place
+struct PinnedType {
+    int a;
+    std::string b;
+
+    PinnedType(int a_, std::string b_) : a(a_), b(std::move(b_)) {}
+    PinnedType(const PinnedType&) = delete;
+    PinnedType(PinnedType&&) = delete;
+};
+
+TEST(TypeValueContainerTest, PiecewiseConstruction) {
+    using PinnedValue = IndexWrapper<0>::TypeValue<PinnedType, 1>;
+    using StringValue = IndexWrapper<1>::TypeValue<std::string, 2>;
+    using Container = OutputIndicesWrapper<1, 2>::TypeValueContainer<PinnedValue, StringValue>;
+
+    Container container(std::piecewise_construct, std::forward_as_tuple(7, "seven"),
+                        std::forward_as_tuple(3, 'x'));
+
+    EXPECT_EQ(container.get<0>().value.a, 7);
+    EXPECT_EQ(container.get<0>().value.b, "seven");
+    EXPECT_EQ(container.get<1>().value, "xxx");
+
+    // The packed layout reorders the bases but keeps the argument order
+    using Packed = OutputIndicesWrapper<1, 2>::PackedTypeValueContainer<
+        IndexWrapper<0>::TypeValue<char, 1>, StringValue>;
+    Packed packed(std::piecewise_construct, std::forward_as_tuple('c'),
+                  std::forward_as_tuple("abc"));
+    EXPECT_EQ(packed.get<0>().value, 'c');
+    EXPECT_EQ(packed.get<1>().value, "abc");
+}
+
+TEST(TypeValueContainerTest, UsesAllocatorConstruction) {
+    using IntValue = IndexWrapper<0>::TypeValue<int, 1>;
+    using PmrStringValue = IndexWrapper<1>::TypeValue<std::pmr::string, 2>;
+    using Container = OutputIndicesWrapper<1, 2>::TypeValueContainer<IntValue, PmrStringValue>;
+
+    static_assert(!std::uses_allocator_v<IntValue, std::pmr::polymorphic_allocator<char>>);
+    static_assert(std::uses_allocator_v<PmrStringValue, std::pmr::polymorphic_allocator<char>>);
+
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    std::pmr::polymorphic_allocator<char> alloc(&arena);
+
+    const std::string long_text(100, 'q');
+    Container piecewise(std::allocator_arg, alloc, std::piecewise_construct,
+                        std::forward_as_tuple(5), std::forward_as_tuple(long_text));
+    EXPECT_EQ(piecewise.get<0>().value, 5);
+    EXPECT_EQ(std::string_view(piecewise.get<1>().value), long_text);
+    EXPECT_EQ(piecewise.get<1>().value.get_allocator().resource(), &arena);
+
+    // Moving in a value from another resource re-allocates it in the arena
+    Container moved(std::allocator_arg, alloc, IntValue(6),
+                    PmrStringValue(std::pmr::string(long_text)));
+    EXPECT_EQ(std::string_view(moved.get<1>().value), long_text);
+    EXPECT_EQ(moved.get<1>().value.get_allocator().resource(), &arena);
+
+    // TypeValue itself follows the uses-allocator protocol inside pmr containers
+    std::pmr::vector<PmrStringValue> values(&arena);
+    values.emplace_back(std::in_place, long_text);
+    values.emplace_back(long_text);
+    EXPECT_EQ(values[0].value.get_allocator().resource(), &arena);
+    EXPECT_EQ(std::string_view(values[1].value), long_text);
+}
+
+TEST(TypeValueContainerTest, PmrVectorOfContainers) {
+    using IntValue = IndexWrapper<0>::TypeValue<int, 1>;
+    using PmrStringValue = IndexWrapper<1>::TypeValue<std::pmr::string, 2>;
+    using Container = OutputIndicesWrapper<1, 2>::TypeValueContainer<IntValue, PmrStringValue>;
+    using Packed =
+        OutputIndicesWrapper<1, 2>::PackedTypeValueContainer<IntValue, PmrStringValue>;
+
+    static_assert(std::is_same_v<Container::allocator_type, std::pmr::polymorphic_allocator<char>>);
+    static_assert(std::uses_allocator_v<Container, std::pmr::polymorphic_allocator<char>>);
+    static_assert(std::uses_allocator_v<Packed, std::pmr::polymorphic_allocator<char>>);
+    static_assert(
+        !std::uses_allocator_v<OutputIndicesWrapper<1>::TypeValueContainer<IntValue>,
+                               std::pmr::polymorphic_allocator<char>>);
+
+    std::array<std::byte, 8192> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+
+    const std::string long_text(100, 'q');
+    const Container outside(IntValue(7), PmrStringValue(std::pmr::string(long_text)));
+
+    // Every element, however it gets there, allocates its members in the
+    // vector's arena, also after the vector grows and relocates them
+    std::pmr::vector<Container> containers(&arena);
+    containers.emplace_back(IntValue(1), PmrStringValue(std::pmr::string(long_text)));
+    containers.emplace_back(std::piecewise_construct, std::forward_as_tuple(2),
+                            std::forward_as_tuple(long_text));
+    containers.push_back(outside);
+    containers.push_back(Container(IntValue(4), PmrStringValue(std::pmr::string(long_text))));
+    ASSERT_EQ(containers.size(), 4u);
+    for (std::size_t i = 0; i < containers.size(); ++i) {
+        EXPECT_EQ(std::string_view(containers[i].get<1>().value), long_text);
+        EXPECT_EQ(containers[i].get<1>().value.get_allocator().resource(), &arena);
+    }
+    EXPECT_EQ(containers[2].get<0>().value, 7);
+    EXPECT_EQ(outside.get<1>().value.get_allocator().resource(),
+              std::pmr::get_default_resource());
+
+    std::pmr::vector<Packed> packed(&arena);
+    packed.reserve(2);
+    packed.emplace_back(IntValue(5), PmrStringValue(std::pmr::string(long_text)));
+    packed.push_back(packed[0]);
+    EXPECT_EQ(packed[1].get<0>().value, 5);
+    EXPECT_EQ(packed[1].get<1>().value.get_allocator().resource(), &arena);
+}
+
+TEST(TypeValueContainerTest, ForEachTransformReduce) {
+    using IntValue = IndexWrapper<4>::TypeValue<int, 1, 2>;
+    using StringValue = IndexWrapper<7>::TypeValue<std::string, 3>;
+    using DoubleValue = IndexWrapper<9>::TypeValue<double, 4, 5, 6>;
+    using Container = OutputIndicesWrapper<1, 2, 3, 4, 5, 6>::TypeValueContainer<
+        IntValue, StringValue, DoubleValue>;
+
+    Container container(IntValue(2), StringValue(std::string("ab")), DoubleValue(0.5));
+
+    // The visitor receives the member's index and output indices at compile time
+    std::string visited;
+    for_each(container, [&visited](const auto& value, auto index, auto output_indices) {
+        static_assert(decltype(index)::value == 4 || decltype(index)::value == 7 ||
+                      decltype(index)::value == 9);
+        visited += std::to_string(decltype(index)::value) + ":" +
+                   std::to_string(output_indices.size()) + " ";
+        (void)value;
+    });
+    EXPECT_EQ(visited, "4:2 7:1 9:3 ");
+
+    // Value-only visitors work too
+    transform(container, [](const auto& value) { return value + value; });
+    EXPECT_EQ(container.get<0>().value, 4);
+    EXPECT_EQ(container.get<1>().value, "abab");
+    EXPECT_DOUBLE_EQ(container.get<2>().value, 1.0);
+
+    const Container& const_container = container;
+    std::size_t sizes = reduce(const_container, std::size_t{0},
+                               [](std::size_t acc, const auto& value) { return acc + sizeof(value); });
+    EXPECT_EQ(sizes, sizeof(int) + sizeof(std::string) + sizeof(double));
+
+    std::size_t index_sum = reduce(container, std::size_t{0},
+                                   [](std::size_t acc, const auto&, auto index, auto) {
+                                       return acc + decltype(index)::value;
+                                   });
+    EXPECT_EQ(index_sum, 4u + 7u + 9u);
+}
+
+TEST(TypeValueContainerTest, HomogeneousValuesArray) {
+    using D0 = IndexWrapper<0>::TypeValue<double, 1>;
+    using D1 = IndexWrapper<1>::TypeValue<double, 2>;
+    using D2 = IndexWrapper<2>::TypeValue<double, 3>;
+    using D3 = IndexWrapper<3>::TypeValue<double, 4>;
+    using Container = OutputIndicesWrapper<1, 2, 3, 4>::TypeValueContainer<D0, D1, D2, D3>;
+    using Packed = OutputIndicesWrapper<1, 2, 3, 4>::PackedTypeValueContainer<D0, D1, D2, D3>;
+
+    Container container(D0(1.0), D1(2.0), D2(3.0), D3(4.0));
+    std::array<double, 4> values = load_values(container);
+    EXPECT_EQ(values, (std::array<double, 4>{1.0, 2.0, 3.0, 4.0}));
+
+    for (double& value : values) {
+        value *= 2.0;
+    }
+    store_values(container, values);
+    EXPECT_DOUBLE_EQ(container.get<0>().value, 2.0);
+    EXPECT_DOUBLE_EQ(container.get<3>().value, 8.0);
+
+    const Container& const_container = container;
+    double sum = 0.0;
+    for (double value : load_values(const_container)) {
+        sum += value;
+    }
+    EXPECT_DOUBLE_EQ(sum, 20.0);
+
+    // Declaration order, whatever the storage order
+    Packed packed(D0(1.0), D1(2.0), D2(3.0), D3(4.0));
+    EXPECT_EQ(load_values(packed), (std::array<double, 4>{1.0, 2.0, 3.0, 4.0}));
+}
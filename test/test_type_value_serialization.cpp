@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "type_value_serialization.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using IntValue = IndexWrapper<0>::TypeValue<int, 1>;
+using CharValue = IndexWrapper<1>::TypeValue<char, 2>;
+using DoubleValue = IndexWrapper<2>::TypeValue<double, 3>;
+using StringValue = IndexWrapper<3>::TypeValue<std::string, 4>;
+using VectorValue = IndexWrapper<4>::TypeValue<std::vector<std::uint16_t>, 5>;
+
+TEST(TypeValueSerializationTest, TrivialRoundTrip) {
+    using Container = OutputIndicesWrapper<1, 2, 3>::TypeValueContainer<IntValue, CharValue,
+                                                                         DoubleValue>;
+    static_assert(type_value_trivially_serializable<Container>);
+
+    Container original(IntValue(42), CharValue('k'), DoubleValue(6.5));
+    std::vector<std::uint8_t> image;
+    serialize(original, image);
+
+    // Fingerprint plus the values without any padding
+    EXPECT_EQ(image.size(), sizeof(std::uint64_t) + sizeof(int) + sizeof(char) + sizeof(double));
+
+    Container restored(IntValue(0), CharValue(0), DoubleValue(0));
+    EXPECT_EQ(deserialize(image.data(), image.size(), restored), image.size());
+    EXPECT_EQ(restored.get<0>().value, 42);
+    EXPECT_EQ(restored.get<1>().value, 'k');
+    EXPECT_DOUBLE_EQ(restored.get<2>().value, 6.5);
+}
+
+TEST(TypeValueSerializationTest, ImageIsLayoutIndependent) {
+    using Naive = OutputIndicesWrapper<1, 2, 3>::TypeValueContainer<CharValue, DoubleValue,
+                                                                     IntValue>;
+    using Packed = OutputIndicesWrapper<1, 2, 3>::PackedTypeValueContainer<CharValue, DoubleValue,
+                                                                           IntValue>;
+    static_assert(type_value_fingerprint<Naive> == type_value_fingerprint<Packed>);
+
+    std::vector<std::uint8_t> image;
+    serialize(Naive(CharValue('a'), DoubleValue(1.25), IntValue(-3)), image);
+
+    Packed restored(CharValue(0), DoubleValue(0), IntValue(0));
+    ASSERT_EQ(deserialize(image.data(), image.size(), restored), image.size());
+    EXPECT_EQ(restored.get<0>().value, 'a');
+    EXPECT_DOUBLE_EQ(restored.get<1>().value, 1.25);
+    EXPECT_EQ(restored.get<2>().value, -3);
+}
+
+TEST(TypeValueSerializationTest, LengthPrefixedRoundTrip) {
+    using Container = OutputIndicesWrapper<1, 4, 5>::TypeValueContainer<IntValue, StringValue,
+                                                                         VectorValue>;
+    static_assert(!type_value_trivially_serializable<Container>);
+
+    Container original(IntValue(7), StringValue(std::string("checkpoint")),
+                       VectorValue(std::vector<std::uint16_t>{1, 2, 65535}));
+    std::vector<std::uint8_t> image;
+    serialize(original, image);
+    serialize(original, image);  // appends a second image
+
+    Container restored(IntValue(0), StringValue(std::string()), VectorValue({}));
+    std::size_t consumed = deserialize(image.data(), image.size(), restored);
+    ASSERT_EQ(consumed * 2, image.size());
+    EXPECT_EQ(restored.get<0>().value, 7);
+    EXPECT_EQ(restored.get<1>().value, "checkpoint");
+    EXPECT_EQ(restored.get<2>().value, (std::vector<std::uint16_t>{1, 2, 65535}));
+
+    EXPECT_EQ(deserialize(image.data() + consumed, image.size() - consumed, restored), consumed);
+}
+
+TEST(TypeValueSerializationTest, RejectsMismatchedSchema) {
+    using Container = OutputIndicesWrapper<1, 2>::TypeValueContainer<IntValue, CharValue>;
+    using OtherIndices = OutputIndicesWrapper<1, 3>::TypeValueContainer<IntValue, CharValue>;
+    using OtherMembers = OutputIndicesWrapper<1, 2>::TypeValueContainer<IntValue, DoubleValue>;
+    static_assert(type_value_fingerprint<Container> != type_value_fingerprint<OtherIndices>);
+    static_assert(type_value_fingerprint<Container> != type_value_fingerprint<OtherMembers>);
+
+    std::vector<std::uint8_t> image;
+    serialize(Container(IntValue(1), CharValue('x')), image);
+
+    OtherIndices other(IntValue(0), CharValue(0));
+    EXPECT_EQ(deserialize(image.data(), image.size(), other), 0u);
+
+    // Truncated images are rejected as well
+    Container restored(IntValue(0), CharValue(0));
+    EXPECT_EQ(deserialize(image.data(), image.size() - 1, restored), 0u);
+    EXPECT_EQ(deserialize(image.data(), 3, restored), 0u);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "vector_comparator.h"
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+using Range = VectorComparator::DiffRange;
+
+struct Inputs {
+    std::vector<uint8_t> a;
+    std::vector<uint8_t> b;
+};
+
+// Differences at 3, 10-12 and 40, and b is four bytes longer
+Inputs sample() {
+    Inputs in;
+    for (int i = 0; i < 42; ++i) {
+        in.a.push_back(static_cast<uint8_t>(i));
+    }
+    in.b = in.a;
+    in.b[3] = 0xff;
+    in.b[10] = in.b[11] = in.b[12] = 0;
+    in.b[40] = 0xee;
+    in.b.insert(in.b.end(), {1, 2, 3, 4});
+    return in;
+}
+
+}  // namespace
+
+TEST(VectorComparatorTest, RangesAndCounts) {
+    Inputs in = sample();
+    std::vector<Range> ranges =
+        VectorComparator::compare_ranges(in.a.data(), in.a.size(), in.b.data(), in.b.size());
+    // The run at 40 does not touch the size difference at 42
+    EXPECT_EQ(ranges, (std::vector<Range>{{3, 1}, {10, 3}, {40, 1}, {42, 4}}));
+    EXPECT_EQ(VectorComparator::count_differences(in.a.data(), in.a.size(), in.b.data(),
+                                                  in.b.size()),
+              9u);
+    EXPECT_EQ(VectorComparator::compare(in.a.data(), in.a.size(), in.b.data(), in.b.size()).size(),
+              9u);
+
+    // A run reaching the end of the shorter input merges with the size difference
+    in.b[41] = 0;
+    ranges = VectorComparator::compare_ranges(in.a.data(), in.a.size(), in.b.data(), in.b.size());
+    EXPECT_EQ(ranges.back(), (Range{40, 6}));
+}
+
+TEST(VectorComparatorTest, ForEachDifference) {
+    Inputs in = sample();
+    std::vector<VectorComparator::Difference> expected =
+        VectorComparator::compare(in.a.data(), in.a.size(), in.b.data(), in.b.size());
+    std::size_t k = 0;
+    VectorComparator::for_each_difference(
+        in.a.data(), in.a.size(), in.b.data(), in.b.size(),
+        [&](std::size_t position, uint8_t value1, uint8_t value2) {
+            ASSERT_LT(k, expected.size());
+            EXPECT_EQ(position, expected[k].position);
+            EXPECT_EQ(value1, expected[k].value1);
+            EXPECT_EQ(value2, expected[k].value2);
+            ++k;
+        });
+    EXPECT_EQ(k, expected.size());
+}
+
+TEST(VectorComparatorTest, ParallelMatchesSerial) {
+    thread_pool pool(4);
+    std::size_t n = compare_chunk_size() * 9 + 5;
+    std::vector<uint8_t> a(n, 1);
+    std::vector<uint8_t> b(n + 3, 1);
+    b[7] = 0;
+    std::fill(b.begin() + compare_chunk_size() * 4 - 3, b.begin() + compare_chunk_size() * 4 + 3, 0);
+    b[n - 1] = 0;
+
+    EXPECT_EQ(VectorComparator::compare_ranges(a.data(), n, b.data(), b.size(), &pool),
+              VectorComparator::compare_ranges(a.data(), n, b.data(), b.size()));
+    EXPECT_EQ(VectorComparator::count_differences(a.data(), n, b.data(), b.size(), &pool), 11u);
+    EXPECT_EQ(VectorDiff::first_difference(a.data(), n, b.data(), b.size(), &pool), 7u);
+    EXPECT_FALSE(VectorDiff::are_identical(a.data(), n, b.data(), n, &pool));
+    EXPECT_TRUE(VectorDiff::are_identical(a.data(), n, a.data(), n, &pool));
+}
+
+TEST(VectorComparatorTest, RowsStartAtBaseOffset) {
+    Inputs in = sample();
+    std::ostringstream out;
+    VectorComparator::print_comparison_rows(in.a.data() + 32, 10, in.b.data() + 32, 14, 16, out,
+                                            0x1234520);
+    EXPECT_NE(out.str().find("01234520"), std::string::npos);
+    EXPECT_EQ(out.str().find("00000000"), std::string::npos);
+}
+
+TEST(VectorComparatorTest, HexWriterFormatting) {
+    std::ostringstream out;
+    {
+        HexWriter writer(out);
+        writer.hex_byte(0x0a).hex_byte(0xff) << " ";
+        writer.hex(0x2f, 8) << " ";
+        writer.hex(0x123456789, 8) << " ";
+        writer.dec(0) << " ";
+        writer.dec(1234567) << " ";
+        writer.repeat('-', 3);
+        EXPECT_EQ(out.str(), "");
+    }
+    EXPECT_EQ(out.str(), "0aff 0000002f 123456789 0 1234567 ---");
+
+    // Text longer than the buffer goes straight through in order
+    std::ostringstream big;
+    {
+        HexWriter writer(big);
+        writer << "x";
+        writer.repeat('y', HexWriter::capacity + 10);
+        writer << std::string(HexWriter::capacity + 1, 'z');
+    }
+    EXPECT_EQ(big.str(), "x" + std::string(HexWriter::capacity + 10, 'y') +
+                             std::string(HexWriter::capacity + 1, 'z'));
+}
+
+TEST(VectorComparatorTest, ContextWindows) {
+    std::vector<uint8_t> a(1024, 7);
+    std::vector<uint8_t> b = a;
+    b[100] = 0;
+    b[130] = 0;
+    b[900] = 0;
+
+    std::vector<std::pair<std::size_t, std::size_t>> windows;
+    auto collect = [&](std::size_t begin, std::size_t end) { windows.emplace_back(begin, end); };
+    // Lines 6 and 8 are close enough to share a window; line 56 gets its own
+    VectorComparator::for_each_context_window(a.data(), a.size(), b.data(), b.size(), 16, 1,
+                                              collect);
+    EXPECT_EQ(windows, (std::vector<std::pair<std::size_t, std::size_t>>{{80, 160}, {880, 928}}));
+
+    windows.clear();
+    VectorComparator::for_each_context_window(a.data(), a.size(), b.data(), b.size(), 16,
+                                              VectorComparator::all_lines, collect);
+    EXPECT_EQ(windows, (std::vector<std::pair<std::size_t, std::size_t>>{{0, 1024}}));
+
+    windows.clear();
+    VectorComparator::for_each_context_window(a.data(), a.size(), a.data(), a.size(), 16, 1,
+                                              collect);
+    EXPECT_TRUE(windows.empty());
+
+    // Ranges fed one at a time, e.g. window by window, give the same
+    // stretches, clipped to the bounds
+    windows.clear();
+    VectorComparator::ContextWindows clipped(16, 2, 90, 1000);
+    clipped.add({100, 1}, collect);
+    clipped.add({130, 1}, collect);
+    clipped.add({990, 1}, collect);
+    clipped.finish(collect);
+    EXPECT_EQ(windows, (std::vector<std::pair<std::size_t, std::size_t>>{{90, 176}, {944, 1000}}));
+
+    std::ostringstream out;
+    VectorComparator::print_comparison(a.data(), a.size(), b.data(), b.size(), 16, &out, 1);
+    std::string text = out.str();
+    EXPECT_NE(text.find("... 80 identical bytes ..."), std::string::npos);
+    EXPECT_NE(text.find("... 720 identical bytes ..."), std::string::npos);
+    EXPECT_NE(text.find("... 96 identical bytes ..."), std::string::npos);
+    EXPECT_NE(text.find("00000050"), std::string::npos);
+    EXPECT_EQ(text.find("00000000   |"), std::string::npos);
+    EXPECT_EQ(text.find("000000a0"), std::string::npos);
+
+    // Without a context limit the output is the full listing
+    std::ostringstream full;
+    VectorComparator::print_interleaved_comparison(a.data(), a.size(), b.data(), b.size(), 16,
+                                                   &full);
+    EXPECT_NE(full.str().find("000003f0"), std::string::npos);
+    EXPECT_EQ(full.str().find("identical bytes"), std::string::npos);
+}
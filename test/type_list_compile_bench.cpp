@@ -0,0 +1,82 @@
+// Compile-time benchmark for type_list.h. Nothing here runs: each target
+// compiles this file with one TYPE_LIST_BENCH_<OP> macro defined, so the
+// build time of the target is the cost of that operation on a list of
+// TYPE_LIST_BENCH_SIZE types. Enable with -DTMPL_LIB_COMPILE_BENCHMARKS=ON and
+// time e.g. `cmake --build . --target type_list_bench_sort`; subtract the
+// time of type_list_bench_build, which only creates the list.
+#include "type_list.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#ifndef TYPE_LIST_BENCH_SIZE
+#define TYPE_LIST_BENCH_SIZE 10000
+#endif
+
+using namespace tmpl_lib;
+
+constexpr std::size_t bench_size = TYPE_LIST_BENCH_SIZE;
+
+// Distinct types with a spread of sizes and alignments
+template <std::size_t I>
+struct alignas(1 << (I % 4)) bench_type {
+    char bytes[I % 13 + 1];
+};
+
+template <typename Indices>
+struct make_bench_list;
+
+template <std::size_t... Is>
+struct make_bench_list<std::index_sequence<Is...>> {
+    using type = type_list<bench_type<Is>...>;
+    using doubled = type_list<bench_type<Is / 2>...>;
+};
+
+using bench_list = make_bench_list<std::make_index_sequence<bench_size>>::type;
+
+#if defined(TYPE_LIST_BENCH_BUILD)
+// Baseline: building the list itself
+static_assert(bench_list::size == bench_size);
+#endif
+
+#if defined(TYPE_LIST_BENCH_AT)
+// Every element looked up once, in reverse order
+template <std::size_t... Is>
+constexpr bool reverse_lookup(std::index_sequence<Is...>) {
+    constexpr bool found[] = {
+        std::is_same<at_t<bench_size - 1 - Is, bench_list>, bench_type<bench_size - 1 - Is>>::value...};
+    for (bool f : found) {
+        if (!f) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(reverse_lookup(std::make_index_sequence<bench_size>{}));
+#endif
+
+#if defined(TYPE_LIST_BENCH_INDEX_OF)
+static_assert(index_of_v<bench_type<bench_size - 1>, bench_list> == bench_size - 1);
+static_assert(index_of_v<bench_type<bench_size / 2>, bench_list> == bench_size / 2);
+#endif
+
+#if defined(TYPE_LIST_BENCH_CONCAT)
+static_assert(concat_t<bench_list, bench_list, bench_list>::size == 3 * bench_size);
+#endif
+
+#if defined(TYPE_LIST_BENCH_FILTER)
+template <typename T>
+struct is_small : std::bool_constant<(sizeof(T) < 8)> {};
+static_assert(filter_t<bench_list, is_small>::size < bench_size);
+#endif
+
+#if defined(TYPE_LIST_BENCH_SORT)
+using sorted = sort_by_alignment_t<bench_list>;
+static_assert(alignof(at_t<0, sorted>) >= alignof(at_t<bench_size - 1, sorted>));
+#endif
+
+#if defined(TYPE_LIST_BENCH_UNIQUE)
+using deduplicated =
+    unique_t<make_bench_list<std::make_index_sequence<bench_size>>::doubled>;
+static_assert(deduplicated::size == (bench_size + 1) / 2);
+#endif
@@ -0,0 +1,556 @@
+// bindiff: compares two files of any size in bounded memory.
+//
+// Both inputs are read one window at a time. Regular files are memory-mapped
+// window by window; pipes, terminals and "-" (stdin) are read into a buffer.
+// Each window pair is compared with VectorComparator on a thread pool, and
+// difference runs are joined across window boundaries.
+//
+// Exit status: 0 if the files are identical, 1 if they differ, 2 on error.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "vector_comparator.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BINDIFF_POSIX 1
+#else
+#define BINDIFF_POSIX 0
+#endif
+
+namespace {
+
+// Reads a file front to back, one window at a time
+class window_reader {
+public:
+    explicit window_reader(const std::string& path) : path_(path) {
+#if BINDIFF_POSIX
+        fd_ = path == "-" ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            fail();
+        }
+        // Files such as those in /proc report a size of 0 and are only
+        // readable with read()
+        struct stat st;
+        if (::fstat(fd_, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            mapped_ = true;
+            file_size_ = static_cast<std::size_t>(st.st_size);
+        }
+#else
+        file_ = path == "-" ? stdin : std::fopen(path.c_str(), "rb");
+        if (file_ == nullptr) {
+            fail();
+        }
+#endif
+    }
+
+    window_reader(const window_reader&) = delete;
+    window_reader& operator=(const window_reader&) = delete;
+
+    ~window_reader() {
+#if BINDIFF_POSIX
+        unmap();
+        if (fd_ > STDIN_FILENO) {
+            ::close(fd_);
+        }
+#else
+        if (file_ != nullptr && file_ != stdin) {
+            std::fclose(file_);
+        }
+#endif
+    }
+
+    // Makes the next size bytes available at data(), fewer only at the end of
+    // the file. size must be a multiple of the page size.
+    std::size_t next(std::size_t size) {
+#if BINDIFF_POSIX
+        unmap();
+        if (mapped_) {
+            // A short window must end the file; if the file has grown since
+            // fstat, the rest is read so the window still holds size bytes
+            std::size_t length = std::min(size, file_size_ - offset_);
+            bool mappable = length != 0 && (length == size || ends_at(offset_ + length));
+            void* p = mappable ? ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd_,
+                                        static_cast<off_t>(offset_))
+                               : MAP_FAILED;
+            if (p != MAP_FAILED) {
+                ::madvise(p, length, MADV_SEQUENTIAL);
+                map_ = p;
+                map_length_ = length;
+                data_ = static_cast<const std::uint8_t*>(p);
+                offset_ += length;
+                return length;
+            }
+            // Some files (e.g. in /proc) cannot be mapped; read them instead
+            mapped_ = false;
+            if (::lseek(fd_, static_cast<off_t>(offset_), SEEK_SET) < 0) {
+                fail();
+            }
+        }
+#endif
+        buffer_.resize(size);
+        std::size_t length = 0;
+        while (length < size) {
+            std::size_t got = read_some(buffer_.data() + length, size - length);
+            if (got == 0) {
+                break;
+            }
+            length += got;
+        }
+        data_ = buffer_.data();
+        offset_ += length;
+        return length;
+    }
+
+    // Makes the rest of the file available at data(), for comparisons that
+    // need all of it at once
+    std::size_t rest() {
+        std::size_t length = 0;
+#if BINDIFF_POSIX
+        if (mapped_ && offset_ == 0) {
+            length = next(file_size_);
+            if (mapped_ && ends_at(offset_)) {
+                return length;
+            }
+        }
+#endif
+        // Keeps what the first next() returned, mapped or read, and reads on
+        // to the end of the file
+        std::vector<std::uint8_t> all(data_, data_ + length);
+        for (;;) {
+            length = next(std::size_t(1) << 20);
+            if (length == 0) {
+                break;
+            }
+            all.insert(all.end(), data_, data_ + length);
+        }
+        buffer_.swap(all);
+        data_ = buffer_.data();
+        return buffer_.size();
+    }
+
+    const std::uint8_t* data() const { return data_; }
+    const std::string& path() const { return path_; }
+
+private:
+    [[noreturn]] void fail() const {
+        throw std::system_error(errno, std::generic_category(), path_);
+    }
+
+    std::size_t read_some(std::uint8_t* out, std::size_t size) {
+#if BINDIFF_POSIX
+        for (;;) {
+            ssize_t got = ::read(fd_, out, size);
+            if (got >= 0) {
+                return static_cast<std::size_t>(got);
+            }
+            if (errno != EINTR) {
+                fail();
+            }
+        }
+#else
+        std::size_t got = std::fread(out, 1, size, file_);
+        if (got == 0 && std::ferror(file_)) {
+            fail();
+        }
+        return got;
+#endif
+    }
+
+#if BINDIFF_POSIX
+    // Whether the file has no byte at offset
+    bool ends_at(std::size_t offset) {
+        std::uint8_t probe;
+        for (;;) {
+            ssize_t got = ::pread(fd_, &probe, 1, static_cast<off_t>(offset));
+            if (got >= 0) {
+                return got == 0;
+            }
+            if (errno != EINTR) {
+                fail();
+            }
+        }
+    }
+
+    void unmap() {
+        if (map_ != nullptr) {
+            ::munmap(map_, map_length_);
+            map_ = nullptr;
+        }
+    }
+
+    int fd_ = -1;
+    bool mapped_ = false;
+    std::size_t file_size_ = 0;
+    void* map_ = nullptr;
+    std::size_t map_length_ = 0;
+#else
+    std::FILE* file_ = nullptr;
+#endif
+    std::string path_;
+    std::vector<std::uint8_t> buffer_;
+    const std::uint8_t* data_ = nullptr;
+    std::size_t offset_ = 0;
+};
+
+enum class output_mode { summary, ranges, side_by_side, interleaved, edits };
+
+struct options {
+    output_mode mode = output_mode::summary;
+    std::size_t bytes_per_line = 32;
+    std::size_t context = 1;
+    std::size_t limit = 0;
+    unsigned threads = 0;
+    block_diff_options block;
+    std::string delta_path;
+    std::string paths[2];
+};
+
+void print_usage(std::ostream& out) {
+    out << "usage: bindiff [options] FILE1 FILE2\n"
+           "Compares two files byte by byte; - reads standard input.\n"
+           "\n"
+           "  -s, --summary         print sizes and difference counts (default)\n"
+           "  -r, --ranges          print every run of differing bytes\n"
+           "  -y, --side-by-side    show differing windows side by side\n"
+           "  -i, --interleaved     show differing windows on adjacent lines\n"
+           "  -e, --edits           list kept, moved, inserted and removed blocks, so\n"
+           "                        inserted or deleted bytes do not shift the rest\n"
+           "  -w, --width N         bytes per line in the views (default 32)\n"
+           "  -C, --context N       lines shown around each run in the views (default 1)\n"
+           "  -n, --limit N         stop printing after N runs, windows or edits\n"
+           "  -d, --delta FILE      write a delta that rebuilds FILE2 from FILE1 (see\n"
+           "                        binpatch); implies the block matching of --edits\n"
+           "  -b, --block N         block size of --edits, doubled as --memory requires\n"
+           "                        (default: the smallest that fits --memory)\n"
+           "  -M, --memory N        index memory of --edits in bytes (default 64 MiB)\n"
+           "  -j, --threads N       compare on N threads (default: one per core)\n"
+           "  -h, --help            print this help\n"
+           "\n"
+           "Exit status is 0 if the files are identical, 1 if they differ, 2 on error.\n";
+}
+
+std::size_t parse_count(const char* name, const char* text) {
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long value = std::strtoull(text, &end, 0);
+    if (end == text || *end != '\0' || errno != 0) {
+        throw std::invalid_argument(std::string("invalid value for ") + name + ": " + text);
+    }
+    return static_cast<std::size_t>(value);
+}
+
+options parse_options(int argc, char** argv) {
+    options opts;
+    int path_count = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + arg);
+            }
+            return argv[++i];
+        };
+        if (arg == "-s" || arg == "--summary") {
+            opts.mode = output_mode::summary;
+        } else if (arg == "-r" || arg == "--ranges") {
+            opts.mode = output_mode::ranges;
+        } else if (arg == "-y" || arg == "--side-by-side") {
+            opts.mode = output_mode::side_by_side;
+        } else if (arg == "-i" || arg == "--interleaved") {
+            opts.mode = output_mode::interleaved;
+        } else if (arg == "-e" || arg == "--edits") {
+            opts.mode = output_mode::edits;
+        } else if (arg == "-d" || arg == "--delta") {
+            opts.delta_path = value();
+        } else if (arg == "-b" || arg == "--block") {
+            opts.block.block_size = parse_count(arg.c_str(), value());
+        } else if (arg == "-M" || arg == "--memory") {
+            opts.block.memory_budget = parse_count(arg.c_str(), value());
+        } else if (arg == "-w" || arg == "--width") {
+            opts.bytes_per_line = parse_count(arg.c_str(), value());
+        } else if (arg == "-C" || arg == "--context") {
+            opts.context = parse_count(arg.c_str(), value());
+        } else if (arg == "-n" || arg == "--limit") {
+            opts.limit = parse_count(arg.c_str(), value());
+        } else if (arg == "-j" || arg == "--threads") {
+            opts.threads = static_cast<unsigned>(parse_count(arg.c_str(), value()));
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage(std::cout);
+            std::exit(0);
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            throw std::invalid_argument("unknown option " + arg);
+        } else if (path_count < 2) {
+            opts.paths[path_count++] = arg;
+        } else {
+            throw std::invalid_argument("too many files");
+        }
+    }
+    if (path_count != 2) {
+        throw std::invalid_argument("expected two files");
+    }
+    if (opts.bytes_per_line == 0) {
+        throw std::invalid_argument("width must be positive");
+    }
+    return opts;
+}
+
+// The bytes of both files in one window
+struct window {
+    std::size_t base;
+    const std::uint8_t* data1;
+    std::size_t len1;
+    const std::uint8_t* data2;
+    std::size_t len2;
+
+    std::size_t end() const { return base + std::max(len1, len2); }
+};
+
+// Shows each differing region with some context in one of the colored
+// views, in the stretches of whole lines VectorComparator::ContextWindows
+// picks; a stretch is cut where a window ends. Output is buffered until
+// finish().
+class view_printer {
+public:
+    view_printer(const options& opts, std::ostream& out)
+        : opts_(opts), out_(out), windows_(opts.bytes_per_line, opts.context, 0, 0) {}
+
+    // Starts collecting the differences of w
+    void start(const window& w) {
+        window_ = &w;
+        windows_ = VectorComparator::ContextWindows(opts_.bytes_per_line, opts_.context, w.base,
+                                                    w.end());
+    }
+
+    void add(const VectorComparator::DiffRange& range) {
+        windows_.add(range, [this](std::size_t begin, std::size_t end) { show(begin, end); });
+    }
+
+    // Shows what is left of the current window
+    void flush() {
+        windows_.finish([this](std::size_t begin, std::size_t end) { show(begin, end); });
+    }
+
+    void finish() {
+        if (shown_ != 0) {
+            VectorComparator::print_legend(out_);
+        }
+        out_.flush();
+    }
+
+private:
+    void show(std::size_t begin, std::size_t end) {
+        if (opts_.limit != 0 && shown_ == opts_.limit) {
+            return;
+        }
+        if (shown_++ == 0) {
+            if (opts_.mode == output_mode::side_by_side) {
+                VectorComparator::print_comparison_header(out_);
+            } else {
+                VectorComparator::print_interleaved_header(out_);
+                VectorComparator::print_ruler(out_, opts_.bytes_per_line);
+            }
+        }
+        if (begin > shown_end_) {
+            VectorComparator::print_elision(out_, begin - shown_end_);
+        }
+        shown_end_ = end;
+        const window& w = *window_;
+        std::size_t offset = begin - w.base;
+        std::size_t length = end - begin;
+        std::size_t len1 = w.len1 > offset ? std::min(w.len1 - offset, length) : 0;
+        std::size_t len2 = w.len2 > offset ? std::min(w.len2 - offset, length) : 0;
+        if (opts_.mode == output_mode::side_by_side) {
+            VectorComparator::print_comparison_rows(w.data1 + offset, len1, w.data2 + offset, len2,
+                                                    opts_.bytes_per_line, out_, begin);
+        } else {
+            VectorComparator::print_interleaved_rows(w.data1 + offset, len1, w.data2 + offset,
+                                                     len2, opts_.bytes_per_line, out_, begin);
+        }
+    }
+
+    const options& opts_;
+    HexWriter out_;
+    VectorComparator::ContextWindows windows_;
+    const window* window_ = nullptr;
+    std::size_t shown_end_ = 0;
+    std::size_t shown_ = 0;
+};
+
+// --edits and --delta need both files whole: the index covers all of the first file
+// and matches may come from anywhere in it
+int run_edits(const options& opts) {
+    window_reader file1(opts.paths[0]);
+    window_reader file2(opts.paths[1]);
+    std::size_t size1 = file1.rest();
+    std::size_t size2 = file2.rest();
+
+    std::vector<block_match> matches =
+        block_diff(file1.data(), size1, file2.data(), size2, opts.block);
+    std::size_t totals[4] = {0, 0, 0, 0};
+    std::size_t edits = 0;
+    {
+        HexWriter out(std::cout);
+        for_each_block_edit(matches, size1, size2, [&](const block_edit& edit) {
+            totals[static_cast<int>(edit.kind)] += edit.length;
+            if (opts.mode == output_mode::edits && (opts.limit == 0 || edits < opts.limit)) {
+                VectorComparator::print_block_edit(out, edit);
+            }
+            ++edits;
+        });
+    }
+
+    std::ostream& out = std::cout;
+    if (!opts.delta_path.empty()) {
+        std::vector<std::uint8_t> delta =
+            encode_delta(file1.data(), size1, file2.data(), size2, matches);
+        std::ofstream file(opts.delta_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(delta.data()),
+                   static_cast<std::streamsize>(delta.size()));
+        if (!file.flush()) {
+            throw std::system_error(errno, std::generic_category(), opts.delta_path);
+        }
+        out << opts.delta_path << ": " << delta.size() << " bytes of delta\n";
+    }
+    if (opts.mode == output_mode::edits && edits != 0) {
+        out << "\n";
+    }
+    out << file1.path() << ": " << size1 << " bytes\n";
+    out << file2.path() << ": " << size2 << " bytes\n";
+    if (size1 == size2 && find_mismatch(file1.data(), file2.data(), size1) == size1) {
+        out << "files are identical\n";
+        return 0;
+    }
+    out << "block size " << block_index::choose_block_size(size1, opts.block) << ": kept "
+        << totals[0] << ", moved " << totals[1] << ", inserted " << totals[2] << ", removed "
+        << totals[3] << " bytes\n";
+    return 1;
+}
+
+int run(const options& opts) {
+    if (opts.mode == output_mode::edits || !opts.delta_path.empty()) {
+        return run_edits(opts);
+    }
+    std::unique_ptr<thread_pool> own_pool;
+    if (opts.threads != 0) {
+        own_pool = std::make_unique<thread_pool>(opts.threads);
+    }
+    thread_pool& pool = own_pool ? *own_pool : thread_pool::shared();
+
+    window_reader file1(opts.paths[0]);
+    window_reader file2(opts.paths[1]);
+
+    // A few chunks per thread, so each window keeps the whole pool busy
+    std::size_t window_size =
+        std::max<std::size_t>(compare_chunk_size() * pool.size() * 4, 16u << 20);
+    window_size = window_size / check_env::topology().page_size * check_env::topology().page_size;
+
+    std::ostream& out = std::cout;
+    bool views = opts.mode == output_mode::side_by_side || opts.mode == output_mode::interleaved;
+    view_printer printer(opts, out);
+
+    std::size_t size1 = 0;
+    std::size_t size2 = 0;
+    std::size_t differing = 0;
+    std::size_t runs = 0;
+    std::size_t first = 0;
+    VectorComparator::DiffRange pending{0, 0};
+
+    auto report = [&](const VectorComparator::DiffRange& range) {
+        if (runs == 0) {
+            first = range.offset;
+        }
+        ++runs;
+        differing += range.length;
+        if (opts.mode == output_mode::ranges && (opts.limit == 0 || runs <= opts.limit)) {
+            out << "0x" << std::hex << std::setfill('0') << std::setw(8) << range.offset << " 0x"
+                << std::setw(8) << range.end() << std::dec << " " << range.length << "\n";
+        }
+    };
+
+    for (std::size_t base = 0;;) {
+        window w{base, nullptr, 0, nullptr, 0};
+        w.len1 = file1.next(window_size);
+        w.data1 = file1.data();
+        w.len2 = file2.next(window_size);
+        w.data2 = file2.data();
+        if (w.len1 == 0 && w.len2 == 0) {
+            break;
+        }
+        if (views) {
+            printer.start(w);
+        }
+        VectorComparator::for_each_difference_range(
+            w.data1, w.len1, w.data2, w.len2,
+            [&](VectorComparator::DiffRange range) {
+                range.offset += base;
+                if (views) {
+                    printer.add(range);
+                }
+                if (pending.length != 0 && pending.end() == range.offset) {
+                    pending.length += range.length;
+                    return;
+                }
+                if (pending.length != 0) {
+                    report(pending);
+                }
+                pending = range;
+            },
+            &pool);
+        if (views) {
+            printer.flush();
+        }
+        size1 += w.len1;
+        size2 += w.len2;
+        base = w.end();
+    }
+    if (pending.length != 0) {
+        report(pending);
+    }
+    if (views) {
+        printer.finish();
+    }
+
+    if (opts.mode != output_mode::summary && runs != 0) {
+        out << "\n";
+    }
+    out << file1.path() << ": " << size1 << " bytes\n";
+    out << file2.path() << ": " << size2 << " bytes\n";
+    if (runs == 0) {
+        out << "files are identical\n";
+        return 0;
+    }
+    out << "differing bytes: " << differing << " in " << runs << " run" << (runs == 1 ? "" : "s")
+        << ", first at 0x" << std::hex << first << std::dec << "\n";
+    return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    try {
+        return run(parse_options(argc, argv));
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "bindiff: " << e.what() << "\n";
+        print_usage(std::cerr);
+        return 2;
+    } catch (const std::exception& e) {
+        std::cerr << "bindiff: " << e.what() << "\n";
+        return 2;
+    }
+}
@@ -0,0 +1,56 @@
+// binpatch: rebuilds a file from a base file and a delta written by
+// bindiff --delta.
+//
+// Exit status: 0 on success, 2 on error (including a delta made from a
+// different base).
+
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "binary_delta.h"
+
+namespace {
+
+std::vector<std::uint8_t> read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+    return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file),
+                                     std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 4) {
+        std::cerr << "usage: binpatch BASE DELTA OUTPUT\n"
+                     "Writes the file that DELTA (from bindiff --delta) makes of BASE.\n";
+        return 2;
+    }
+    try {
+        std::vector<std::uint8_t> base = read_file(argv[1]);
+        std::vector<std::uint8_t> delta = read_file(argv[2]);
+        std::vector<std::uint8_t> target;
+        if (!apply_delta(base.data(), base.size(), delta.data(), delta.size(), target)) {
+            std::cerr << "binpatch: " << argv[2] << " is not a delta for " << argv[1] << "\n";
+            return 2;
+        }
+        std::ofstream out(argv[3], std::ios::binary);
+        out.write(reinterpret_cast<const char*>(target.data()),
+                  static_cast<std::streamsize>(target.size()));
+        if (!out.flush()) {
+            throw std::system_error(errno, std::generic_category(), argv[3]);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "binpatch: " << e.what() << "\n";
+        return 2;
+    }
+    return 0;
+}
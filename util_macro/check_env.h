@@ -46,9 +46,527 @@
 // Alternative macro name for compatibility
 #define HAS_UNALIGNED_MEMORY_ACCESS SUPPORTS_UNALIGNED_MEMORY_ACCESS
 
-// Example usage with static_assert
+// x86 targets, where CPU features can be queried at runtime through cpuid
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define CHECK_ENV_X86 1
+#else
+    #define CHECK_ENV_X86 0
+#endif
+
+// Byte order of the target
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+    #define CHECK_ENV_BIG_ENDIAN (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#else
+    #define CHECK_ENV_BIG_ENDIAN 0
+#endif
+
+// Compiles one function for an instruction set the rest of the binary does
+// not assume, e.g. CHECK_ENV_TARGET("avx2,bmi2"). MSVC needs no attribute.
+#if defined(__GNUC__) || defined(__clang__)
+    #define CHECK_ENV_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define CHECK_ENV_TARGET(isa)
+#endif
+
 #ifdef __cplusplus
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <unistd.h>
+#endif
+#if defined(__APPLE__)
+    #include <sys/sysctl.h>
+#endif
+
+#if CHECK_ENV_X86 && (defined(__GNUC__) || defined(__clang__))
+    #include <cpuid.h>
+#elif CHECK_ENV_X86 && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// Example usage with static_assert
 namespace check_env {
     constexpr bool supports_unaligned_access = SUPPORTS_UNALIGNED_MEMORY_ACCESS;
+
+    // Reads a T stored at any address. memcpy of a constant size is a single
+    // load where the target allows unaligned access; elsewhere unsigned
+    // integers are assembled from bytes, which is what a misaligned load
+    // would have to do anyway. Neither breaks strict aliasing.
+    template <typename T>
+    inline T load_unaligned(const void* p) noexcept {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        T value;
+#if SUPPORTS_UNALIGNED_MEMORY_ACCESS
+        std::memcpy(&value, p, sizeof(T));
+#else
+        if constexpr (std::is_integral<T>::value && std::is_unsigned<T>::value) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(p);
+            value = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i) {
+                std::size_t shift = CHECK_ENV_BIG_ENDIAN ? sizeof(T) - 1 - i : i;
+                value = static_cast<T>(value | static_cast<T>(bytes[i]) << (8 * shift));
+            }
+        } else {
+            std::memcpy(&value, p, sizeof(T));
+        }
+#endif
+        return value;
+    }
+
+    // Writes a T to any address; see load_unaligned
+    template <typename T>
+    inline void store_unaligned(void* p, T value) noexcept {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+#if SUPPORTS_UNALIGNED_MEMORY_ACCESS
+        std::memcpy(p, &value, sizeof(T));
+#else
+        if constexpr (std::is_integral<T>::value && std::is_unsigned<T>::value) {
+            unsigned char* bytes = static_cast<unsigned char*>(p);
+            for (std::size_t i = 0; i < sizeof(T); ++i) {
+                std::size_t shift = CHECK_ENV_BIG_ENDIAN ? sizeof(T) - 1 - i : i;
+                bytes[i] = static_cast<unsigned char>(value >> (8 * shift));
+            }
+        } else {
+            std::memcpy(p, &value, sizeof(T));
+        }
+#endif
+    }
+
+    // Reads n consecutive Ts from any address into dst
+    template <typename T>
+    inline void load_unaligned_n(const void* src, T* dst, std::size_t n) noexcept {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        if (n != 0) {
+            std::memcpy(dst, src, n * sizeof(T));
+        }
+    }
+
+    // Writes n consecutive Ts from src to any address
+    template <typename T>
+    inline void store_unaligned_n(void* dst, const T* src, std::size_t n) noexcept {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        if (n != 0) {
+            std::memcpy(dst, src, n * sizeof(T));
+        }
+    }
+
+    // Best guesses for the memory hierarchy, for sizes that must be known at
+    // compile time (alignas, array bounds). Apple and POWER CPUs use 128-byte
+    // lines, Apple arm64 uses 16 KiB pages.
+#if (defined(__APPLE__) && defined(__aarch64__)) || defined(__powerpc64__)
+    constexpr std::size_t default_cache_line_size = 128;
+#else
+    constexpr std::size_t default_cache_line_size = 64;
+#endif
+#if defined(__APPLE__) && defined(__aarch64__)
+    constexpr std::size_t default_page_size = 16384;
+#else
+    constexpr std::size_t default_page_size = 4096;
+#endif
+    constexpr std::size_t default_huge_page_size = 2 * 1024 * 1024;
+    constexpr std::size_t default_l1d_cache_size = 32 * 1024;
+    constexpr std::size_t default_l2_cache_size = 1024 * 1024;
+    constexpr std::size_t default_l3_cache_size = 8 * 1024 * 1024;
+
+    // The memory hierarchy and CPU counts of the running machine. Anything
+    // that cannot be detected keeps its default; l3_cache_size is 0 on
+    // machines detected to have no L3.
+    struct system_topology {
+        std::size_t cache_line_size = default_cache_line_size;
+        std::size_t l1d_cache_size = default_l1d_cache_size;
+        std::size_t l2_cache_size = default_l2_cache_size;
+        std::size_t l3_cache_size = default_l3_cache_size;
+        std::size_t page_size = default_page_size;
+        std::size_t huge_page_size = default_huge_page_size;
+        unsigned logical_cpus = 1;
+        unsigned physical_cores = 1;
+        // Hardware threads per core
+        unsigned smt_width = 1;
+    };
+
+    namespace detail {
+        // Parses sysfs sizes such as "48K", "2048 kB" or "2097152"; 0 if invalid
+        inline std::size_t parse_size(const char* text) {
+            char* end = nullptr;
+            unsigned long long value = std::strtoull(text, &end, 10);
+            if (end == text) {
+                return 0;
+            }
+            while (*end == ' ') {
+                ++end;
+            }
+            switch (*end) {
+            case 'K':
+            case 'k':
+                value <<= 10;
+                break;
+            case 'M':
+            case 'm':
+                value <<= 20;
+                break;
+            case 'G':
+            case 'g':
+                value <<= 30;
+                break;
+            default:
+                break;
+            }
+            return static_cast<std::size_t>(value);
+        }
+
+        // Number of CPUs in a sysfs cpu list such as "0-3,8,10-11"
+        inline unsigned count_cpu_list(const char* text) {
+            unsigned count = 0;
+            while (*text != '\0' && *text != '\n') {
+                char* end = nullptr;
+                unsigned long first = std::strtoul(text, &end, 10);
+                if (end == text) {
+                    break;
+                }
+                unsigned long last = first;
+                if (*end == '-') {
+                    text = end + 1;
+                    last = std::strtoul(text, &end, 10);
+                    if (end == text || last < first) {
+                        break;
+                    }
+                }
+                count += static_cast<unsigned>(last - first + 1);
+                text = *end == ',' ? end + 1 : end;
+            }
+            return count;
+        }
+
+        // The first line of a small text file, false if it cannot be read
+        inline bool read_line(const char* path, char* line, int size) {
+            std::FILE* file = std::fopen(path, "r");
+            if (file == nullptr) {
+                return false;
+            }
+            bool ok = std::fgets(line, size, file) != nullptr;
+            std::fclose(file);
+            return ok;
+        }
+
+#if defined(__linux__)
+        // Cache sizes and line size of cpu0 from /sys/devices/system/cpu
+        inline bool read_sysfs_caches(system_topology& t) {
+            bool found = false;
+            bool has_l3 = false;
+            char path[96];
+            char line[64];
+            for (int index = 0; index < 16; ++index) {
+                std::snprintf(path, sizeof(path),
+                              "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+                if (!read_line(path, line, sizeof(line))) {
+                    break;
+                }
+                int level = std::atoi(line);
+                std::snprintf(path, sizeof(path),
+                              "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+                if (!read_line(path, line, sizeof(line)) ||
+                    std::strncmp(line, "Instruction", 11) == 0) {
+                    continue;
+                }
+                std::snprintf(path, sizeof(path),
+                              "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+                std::size_t size = read_line(path, line, sizeof(line)) ? parse_size(line) : 0;
+                if (size == 0) {
+                    continue;
+                }
+                found = true;
+                if (level == 1) {
+                    t.l1d_cache_size = size;
+                    std::snprintf(path, sizeof(path),
+                                  "/sys/devices/system/cpu/cpu0/cache/index%d/coherency_line_size",
+                                  index);
+                    std::size_t line_size =
+                        read_line(path, line, sizeof(line)) ? parse_size(line) : 0;
+                    if (line_size != 0) {
+                        t.cache_line_size = line_size;
+                    }
+                } else if (level == 2) {
+                    t.l2_cache_size = size;
+                } else if (level == 3) {
+                    t.l3_cache_size = size;
+                    has_l3 = true;
+                }
+            }
+            if (found && !has_l3) {
+                t.l3_cache_size = 0;
+            }
+            return found;
+        }
+#endif
+
+        inline system_topology detect_topology() {
+            system_topology t;
+#if defined(__unix__) || defined(__APPLE__)
+            long page = sysconf(_SC_PAGESIZE);
+            if (page > 0) {
+                t.page_size = static_cast<std::size_t>(page);
+            }
+            long online = sysconf(_SC_NPROCESSORS_ONLN);
+            if (online > 0) {
+                t.logical_cpus = static_cast<unsigned>(online);
+            }
+#endif
+#if defined(__linux__)
+            if (!read_sysfs_caches(t)) {
+                // glibc answers these from cpuid where sysfs is hidden
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+                long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+                long line_size = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+                long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+                long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+                if (l1 > 0) {
+                    t.l1d_cache_size = static_cast<std::size_t>(l1);
+                }
+                if (line_size > 0) {
+                    t.cache_line_size = static_cast<std::size_t>(line_size);
+                }
+                if (l2 > 0) {
+                    t.l2_cache_size = static_cast<std::size_t>(l2);
+                }
+                if (l3 > 0) {
+                    t.l3_cache_size = static_cast<std::size_t>(l3);
+                }
+#endif
+            }
+
+            char line[256];
+            if (read_line("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", line,
+                          sizeof(line))) {
+                std::size_t size = parse_size(line);
+                if (size != 0) {
+                    t.huge_page_size = size;
+                }
+            } else if (std::FILE* meminfo = std::fopen("/proc/meminfo", "r")) {
+                while (std::fgets(line, sizeof(line), meminfo) != nullptr) {
+                    if (std::strncmp(line, "Hugepagesize:", 13) == 0) {
+                        std::size_t size = parse_size(line + 13);
+                        if (size != 0) {
+                            t.huge_page_size = size;
+                        }
+                        break;
+                    }
+                }
+                std::fclose(meminfo);
+            }
+
+            if (read_line("/sys/devices/system/cpu/cpu0/topology/thread_siblings_list", line,
+                          sizeof(line))) {
+                unsigned siblings = count_cpu_list(line);
+                if (siblings > 0) {
+                    t.smt_width = siblings;
+                }
+            }
+#elif defined(__APPLE__)
+            std::size_t value = 0;
+            std::size_t length = sizeof(value);
+            if (sysctlbyname("hw.cachelinesize", &value, &length, nullptr, 0) == 0 && value != 0) {
+                t.cache_line_size = value;
+            }
+            length = sizeof(value);
+            if (sysctlbyname("hw.l1dcachesize", &value, &length, nullptr, 0) == 0 && value != 0) {
+                t.l1d_cache_size = value;
+            }
+            length = sizeof(value);
+            if (sysctlbyname("hw.l2cachesize", &value, &length, nullptr, 0) == 0 && value != 0) {
+                t.l2_cache_size = value;
+            }
+            length = sizeof(value);
+            t.l3_cache_size =
+                sysctlbyname("hw.l3cachesize", &value, &length, nullptr, 0) == 0 ? value : 0;
+            int cores = 0;
+            length = sizeof(cores);
+            if (sysctlbyname("hw.physicalcpu", &cores, &length, nullptr, 0) == 0 && cores > 0 &&
+                t.logical_cpus % static_cast<unsigned>(cores) == 0) {
+                t.smt_width = t.logical_cpus / static_cast<unsigned>(cores);
+            }
+#endif
+            if (t.logical_cpus <= 1) {
+                unsigned hardware = std::thread::hardware_concurrency();
+                if (hardware > 0) {
+                    t.logical_cpus = hardware;
+                }
+            }
+            if (t.smt_width == 0 || t.smt_width > t.logical_cpus) {
+                t.smt_width = 1;
+            }
+            t.physical_cores = t.logical_cpus / t.smt_width;
+            return t;
+        }
+    }
+
+    // Detected on first use and cached for the life of the process
+    inline const system_topology& topology() {
+        static const system_topology detected = detail::detect_topology();
+        return detected;
+    }
+
+    // How many Ts fit in 1/divisor of the L1 data cache, at least 1. Sizes
+    // batches that should stay in L1 while they are worked on.
+    template <typename T>
+    inline std::size_t l1_batch_size(std::size_t divisor = 2) {
+        std::size_t count = topology().l1d_cache_size / divisor / sizeof(T);
+        return count > 0 ? count : 1;
+    }
+
+    // Worker threads for CPU-bound work: one per physical core, since SMT
+    // siblings share the execution units such work saturates
+    inline unsigned worker_thread_count() {
+        return topology().physical_cores;
+    }
+
+    // Instruction set extensions usable on the running CPU; the AVX ones also
+    // require the OS to save the wider registers
+    struct cpu_features {
+        bool sse42 = false;
+        bool popcnt = false;
+        bool avx2 = false;
+        bool bmi2 = false;
+        bool avx512f = false;
+        bool avx512bw = false;
+    };
+
+    namespace detail {
+#if CHECK_ENV_X86
+        // eax, ebx, ecx, edx of cpuid(leaf, subleaf)
+        inline void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int out[4];
+            __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (int i = 0; i < 4; ++i) {
+                regs[i] = static_cast<unsigned>(out[i]);
+            }
+#else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        }
+
+        // XCR0: which register states the OS saves on context switches
+        inline unsigned long long xgetbv0() {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return _xgetbv(0);
+#else
+            unsigned eax = 0;
+            unsigned edx = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+        }
+#endif
+
+        inline cpu_features detect_cpu_features() {
+            cpu_features features;
+#if CHECK_ENV_X86
+            unsigned regs[4] = {};
+            cpuid(0, 0, regs);
+            unsigned max_leaf = regs[0];
+            if (max_leaf < 1) {
+                return features;
+            }
+
+            cpuid(1, 0, regs);
+            features.sse42 = (regs[2] >> 20) & 1;
+            features.popcnt = (regs[2] >> 23) & 1;
+            bool osxsave = (regs[2] >> 27) & 1;
+            bool avx = (regs[2] >> 28) & 1;
+            unsigned long long xcr0 = osxsave ? xgetbv0() : 0;
+            // SSE and AVX state; plus opmask and both halves of ZMM state
+            bool ymm_saved = (xcr0 & 0x06) == 0x06;
+            bool zmm_saved = (xcr0 & 0xe6) == 0xe6;
+
+            if (max_leaf >= 7) {
+                cpuid(7, 0, regs);
+                features.avx2 = avx && ymm_saved && ((regs[1] >> 5) & 1);
+                features.bmi2 = (regs[1] >> 8) & 1;
+                features.avx512f = zmm_saved && ((regs[1] >> 16) & 1);
+                features.avx512bw = features.avx512f && ((regs[1] >> 30) & 1);
+            }
+#endif
+            return features;
+        }
+    }
+
+    // Detected on first use and cached for the life of the process
+    inline const cpu_features& cpu() {
+        static const cpu_features features = detail::detect_cpu_features();
+        return features;
+    }
+
+    // Kernel tiers, each including everything below it:
+    //   sse42:  SSE4.2 + POPCNT
+    //   avx2:   sse42 + AVX2 + BMI2
+    //   avx512: avx2 + AVX-512F + AVX-512BW
+    enum class isa_level { baseline, sse42, avx2, avx512 };
+
+    inline isa_level best_isa_level() {
+        const cpu_features& f = cpu();
+        if (!(f.sse42 && f.popcnt)) {
+            return isa_level::baseline;
+        }
+        if (!(f.avx2 && f.bmi2)) {
+            return isa_level::sse42;
+        }
+        if (!(f.avx512f && f.avx512bw)) {
+            return isa_level::avx2;
+        }
+        return isa_level::avx512;
+    }
+
+    // One implementation of a kernel per tier; null entries are skipped
+    template <typename Fn>
+    struct kernel_set {
+        Fn* baseline;
+        Fn* sse42 = nullptr;
+        Fn* avx2 = nullptr;
+        Fn* avx512 = nullptr;
+    };
+
+    // The implementation for the highest tier not above level
+    template <typename Fn>
+    Fn* select_kernel(const kernel_set<Fn>& set, isa_level level = best_isa_level()) {
+        if (level >= isa_level::avx512 && set.avx512 != nullptr) {
+            return set.avx512;
+        }
+        if (level >= isa_level::avx2 && set.avx2 != nullptr) {
+            return set.avx2;
+        }
+        if (level >= isa_level::sse42 && set.sse42 != nullptr) {
+            return set.sse42;
+        }
+        return set.baseline;
+    }
+
+    template <typename Fn>
+    class kernel;
+
+    // A function pointer chosen once, when the kernel is constructed. Declare
+    // kernels as statics so the choice happens at startup (or first use):
+    //
+    //   static const check_env::kernel<std::size_t(const char*, std::size_t)> count(
+    //       {&count_scalar, &count_sse42, &count_avx2});
+    template <typename R, typename... Args>
+    class kernel<R(Args...)> {
+    public:
+        explicit kernel(const kernel_set<R(Args...)>& set,
+                        isa_level level = best_isa_level())
+            : fn_(select_kernel(set, level)) {}
+
+        R operator()(Args... args) const { return fn_(static_cast<Args>(args)...); }
+
+        R (*get() const)(Args...) { return fn_; }
+
+    private:
+        R (*fn_)(Args...);
+    };
 }
 #endif
@@ -1,96 +1,1616 @@
 #ifndef UTIL_MACRO_H
 #define UTIL_MACRO_H
 
+// Every macro below that takes a variable number of arguments accepts up to
+// 256 of them. Macros that walk the arguments are ladders of short rungs,
+// one per remaining argument, entered at the rung for the actual count: an
+// expansion only pays for the arguments it is given, never for the size of
+// the ladder.
+
 // clang-format off
+#define UTIL_MACRO_CAT(a, b) UTIL_MACRO_CAT_IMPL(a, b)
+#define UTIL_MACRO_CAT_IMPL(a, b) a##b
+
 // Helper macros to count the number of arguments in a variadic macro
-#define UTIL_MACRO_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
-#define UTIL_MACRO_COUNT(...) UTIL_MACRO_COUNT_IMPL(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define UTIL_MACRO_COUNT_IMPL( \
+    _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, \
+    _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, \
+    _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, \
+    _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, \
+    _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, \
+    _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, \
+    _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, \
+    _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125, _126, _127, _128, \
+    _129, _130, _131, _132, _133, _134, _135, _136, _137, _138, _139, _140, _141, _142, _143, _144, \
+    _145, _146, _147, _148, _149, _150, _151, _152, _153, _154, _155, _156, _157, _158, _159, _160, \
+    _161, _162, _163, _164, _165, _166, _167, _168, _169, _170, _171, _172, _173, _174, _175, _176, \
+    _177, _178, _179, _180, _181, _182, _183, _184, _185, _186, _187, _188, _189, _190, _191, _192, \
+    _193, _194, _195, _196, _197, _198, _199, _200, _201, _202, _203, _204, _205, _206, _207, _208, \
+    _209, _210, _211, _212, _213, _214, _215, _216, _217, _218, _219, _220, _221, _222, _223, _224, \
+    _225, _226, _227, _228, _229, _230, _231, _232, _233, _234, _235, _236, _237, _238, _239, _240, \
+    _241, _242, _243, _244, _245, _246, _247, _248, _249, _250, _251, _252, _253, _254, _255, _256, \
+    N, ...) N
+#define UTIL_MACRO_COUNT(...) UTIL_MACRO_COUNT_IMPL(__VA_ARGS__, \
+    256, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, \
+    240, 239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, \
+    224, 223, 222, 221, 220, 219, 218, 217, 216, 215, 214, 213, 212, 211, 210, 209, \
+    208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198, 197, 196, 195, 194, 193, \
+    192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, \
+    176, 175, 174, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, \
+    160, 159, 158, 157, 156, 155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145, \
+    144, 143, 142, 141, 140, 139, 138, 137, 136, 135, 134, 133, 132, 131, 130, 129, \
+    128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, \
+    112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, \
+    96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, \
+    80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, \
+    64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, \
+    48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, \
+    32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, \
+    16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, \
+    0)
 
 // Helper macro to get a list of arguments from 1 to N
 #define UTIL_MACRO_LIST(...) __VA_ARGS__
 
 // Helper macro to get the first M arguments from __VA_ARGS__
 #define UTIL_MACRO_FIRST_M_IMPL(M, ...) UTIL_MACRO_FIRST_M_##M(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M(M, ...) UTIL_MACRO_FIRST_M_IMPL(M, __VA_ARGS__)
 #define UTIL_MACRO_FIRST_M_1(_1, ...) _1
-#define UTIL_MACRO_FIRST_M_2(_1, _2, ...) _1, _2
-#define UTIL_MACRO_FIRST_M_3(_1, _2, _3, ...) _1, _2, _3
-#define UTIL_MACRO_FIRST_M_4(_1, _2, _3, _4, ...) _1, _2, _3, _4
-#define UTIL_MACRO_FIRST_M_5(_1, _2, _3, _4, _5, ...) _1, _2, _3, _4, _5
-#define UTIL_MACRO_FIRST_M_6(_1, _2, _3, _4, _5, _6, ...) _1, _2, _3, _4, _5, _6
-#define UTIL_MACRO_FIRST_M_7(_1, _2, _3, _4, _5, _6, _7, ...) _1, _2, _3, _4, _5, _6, _7
-#define UTIL_MACRO_FIRST_M_8(_1, _2, _3, _4, _5, _6, _7, _8, ...) _1, _2, _3, _4, _5, _6, _7, _8
-#define UTIL_MACRO_FIRST_M_9(_1, _2, _3, _4, _5, _6, _7, _8, _9, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9
-#define UTIL_MACRO_FIRST_M_10(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10
-#define UTIL_MACRO_FIRST_M_11(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11
-#define UTIL_MACRO_FIRST_M_12(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12
-#define UTIL_MACRO_FIRST_M_13(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13
-#define UTIL_MACRO_FIRST_M_14(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14
-#define UTIL_MACRO_FIRST_M_15(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15
-#define UTIL_MACRO_FIRST_M_16(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16
-#define UTIL_MACRO_FIRST_M_17(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17
-#define UTIL_MACRO_FIRST_M_18(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18
-#define UTIL_MACRO_FIRST_M_19(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19
-#define UTIL_MACRO_FIRST_M_20(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20
-#define UTIL_MACRO_FIRST_M_21(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21
-#define UTIL_MACRO_FIRST_M_22(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22
-#define UTIL_MACRO_FIRST_M_23(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23
-#define UTIL_MACRO_FIRST_M_24(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24
-#define UTIL_MACRO_FIRST_M_25(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25
-#define UTIL_MACRO_FIRST_M_26(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26
-#define UTIL_MACRO_FIRST_M_27(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27
-#define UTIL_MACRO_FIRST_M_28(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28
-#define UTIL_MACRO_FIRST_M_29(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29
-#define UTIL_MACRO_FIRST_M_30(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30
-#define UTIL_MACRO_FIRST_M_31(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31
-#define UTIL_MACRO_FIRST_M_32(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32
-#define UTIL_MACRO_FIRST_M_33(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33
-#define UTIL_MACRO_FIRST_M_34(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34
-#define UTIL_MACRO_FIRST_M_35(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35
-#define UTIL_MACRO_FIRST_M_36(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36
-#define UTIL_MACRO_FIRST_M_37(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37
-#define UTIL_MACRO_FIRST_M_38(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38
-#define UTIL_MACRO_FIRST_M_39(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39
-#define UTIL_MACRO_FIRST_M_40(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40
-#define UTIL_MACRO_FIRST_M_41(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41
-#define UTIL_MACRO_FIRST_M_42(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42
-#define UTIL_MACRO_FIRST_M_43(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43
-#define UTIL_MACRO_FIRST_M_44(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44
-#define UTIL_MACRO_FIRST_M_45(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45
-#define UTIL_MACRO_FIRST_M_46(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46
-#define UTIL_MACRO_FIRST_M_47(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47
-#define UTIL_MACRO_FIRST_M_48(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48
-#define UTIL_MACRO_FIRST_M_49(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49
-#define UTIL_MACRO_FIRST_M_50(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50
-#define UTIL_MACRO_FIRST_M_51(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51
-#define UTIL_MACRO_FIRST_M_52(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52
-#define UTIL_MACRO_FIRST_M_53(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53
-#define UTIL_MACRO_FIRST_M_54(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54
-#define UTIL_MACRO_FIRST_M_55(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55
-#define UTIL_MACRO_FIRST_M_56(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55
-#define UTIL_MACRO_FIRST_M_57(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55
-#define UTIL_MACRO_FIRST_M_58(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58
-#define UTIL_MACRO_FIRST_M_59(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59
-#define UTIL_MACRO_FIRST_M_60(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60
-#define UTIL_MACRO_FIRST_M_61(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61
-#define UTIL_MACRO_FIRST_M_62(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62
-#define UTIL_MACRO_FIRST_M_63(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63
-#define UTIL_MACRO_FIRST_M_64(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64
-#define UTIL_MACRO_FIRST_M_65(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65
-#define UTIL_MACRO_FIRST_M_66(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66
-#define UTIL_MACRO_FIRST_M_67(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67
-#define UTIL_MACRO_FIRST_M_68(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68
-#define UTIL_MACRO_FIRST_M_69(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69
-#define UTIL_MACRO_FIRST_M_70(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70
-#define UTIL_MACRO_FIRST_M_71(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71
-#define UTIL_MACRO_FIRST_M_72(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72
-#define UTIL_MACRO_FIRST_M_73(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73
-#define UTIL_MACRO_FIRST_M_74(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74
-#define UTIL_MACRO_FIRST_M_75(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75
-#define UTIL_MACRO_FIRST_M_76(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76
-#define UTIL_MACRO_FIRST_M_77(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77
-#define UTIL_MACRO_FIRST_M_78(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78
-#define UTIL_MACRO_FIRST_M_79(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, ...) _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79
+#define UTIL_MACRO_FIRST_M_2(_1, ...) _1, UTIL_MACRO_FIRST_M_1(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_3(_1, ...) _1, UTIL_MACRO_FIRST_M_2(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_4(_1, ...) _1, UTIL_MACRO_FIRST_M_3(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_5(_1, ...) _1, UTIL_MACRO_FIRST_M_4(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_6(_1, ...) _1, UTIL_MACRO_FIRST_M_5(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_7(_1, ...) _1, UTIL_MACRO_FIRST_M_6(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_8(_1, ...) _1, UTIL_MACRO_FIRST_M_7(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_9(_1, ...) _1, UTIL_MACRO_FIRST_M_8(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_10(_1, ...) _1, UTIL_MACRO_FIRST_M_9(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_11(_1, ...) _1, UTIL_MACRO_FIRST_M_10(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_12(_1, ...) _1, UTIL_MACRO_FIRST_M_11(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_13(_1, ...) _1, UTIL_MACRO_FIRST_M_12(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_14(_1, ...) _1, UTIL_MACRO_FIRST_M_13(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_15(_1, ...) _1, UTIL_MACRO_FIRST_M_14(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_16(_1, ...) _1, UTIL_MACRO_FIRST_M_15(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_17(_1, ...) _1, UTIL_MACRO_FIRST_M_16(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_18(_1, ...) _1, UTIL_MACRO_FIRST_M_17(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_19(_1, ...) _1, UTIL_MACRO_FIRST_M_18(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_20(_1, ...) _1, UTIL_MACRO_FIRST_M_19(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_21(_1, ...) _1, UTIL_MACRO_FIRST_M_20(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_22(_1, ...) _1, UTIL_MACRO_FIRST_M_21(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_23(_1, ...) _1, UTIL_MACRO_FIRST_M_22(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_24(_1, ...) _1, UTIL_MACRO_FIRST_M_23(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_25(_1, ...) _1, UTIL_MACRO_FIRST_M_24(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_26(_1, ...) _1, UTIL_MACRO_FIRST_M_25(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_27(_1, ...) _1, UTIL_MACRO_FIRST_M_26(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_28(_1, ...) _1, UTIL_MACRO_FIRST_M_27(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_29(_1, ...) _1, UTIL_MACRO_FIRST_M_28(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_30(_1, ...) _1, UTIL_MACRO_FIRST_M_29(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_31(_1, ...) _1, UTIL_MACRO_FIRST_M_30(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_32(_1, ...) _1, UTIL_MACRO_FIRST_M_31(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_33(_1, ...) _1, UTIL_MACRO_FIRST_M_32(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_34(_1, ...) _1, UTIL_MACRO_FIRST_M_33(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_35(_1, ...) _1, UTIL_MACRO_FIRST_M_34(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_36(_1, ...) _1, UTIL_MACRO_FIRST_M_35(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_37(_1, ...) _1, UTIL_MACRO_FIRST_M_36(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_38(_1, ...) _1, UTIL_MACRO_FIRST_M_37(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_39(_1, ...) _1, UTIL_MACRO_FIRST_M_38(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_40(_1, ...) _1, UTIL_MACRO_FIRST_M_39(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_41(_1, ...) _1, UTIL_MACRO_FIRST_M_40(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_42(_1, ...) _1, UTIL_MACRO_FIRST_M_41(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_43(_1, ...) _1, UTIL_MACRO_FIRST_M_42(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_44(_1, ...) _1, UTIL_MACRO_FIRST_M_43(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_45(_1, ...) _1, UTIL_MACRO_FIRST_M_44(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_46(_1, ...) _1, UTIL_MACRO_FIRST_M_45(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_47(_1, ...) _1, UTIL_MACRO_FIRST_M_46(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_48(_1, ...) _1, UTIL_MACRO_FIRST_M_47(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_49(_1, ...) _1, UTIL_MACRO_FIRST_M_48(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_50(_1, ...) _1, UTIL_MACRO_FIRST_M_49(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_51(_1, ...) _1, UTIL_MACRO_FIRST_M_50(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_52(_1, ...) _1, UTIL_MACRO_FIRST_M_51(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_53(_1, ...) _1, UTIL_MACRO_FIRST_M_52(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_54(_1, ...) _1, UTIL_MACRO_FIRST_M_53(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_55(_1, ...) _1, UTIL_MACRO_FIRST_M_54(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_56(_1, ...) _1, UTIL_MACRO_FIRST_M_55(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_57(_1, ...) _1, UTIL_MACRO_FIRST_M_56(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_58(_1, ...) _1, UTIL_MACRO_FIRST_M_57(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_59(_1, ...) _1, UTIL_MACRO_FIRST_M_58(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_60(_1, ...) _1, UTIL_MACRO_FIRST_M_59(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_61(_1, ...) _1, UTIL_MACRO_FIRST_M_60(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_62(_1, ...) _1, UTIL_MACRO_FIRST_M_61(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_63(_1, ...) _1, UTIL_MACRO_FIRST_M_62(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_64(_1, ...) _1, UTIL_MACRO_FIRST_M_63(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_65(_1, ...) _1, UTIL_MACRO_FIRST_M_64(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_66(_1, ...) _1, UTIL_MACRO_FIRST_M_65(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_67(_1, ...) _1, UTIL_MACRO_FIRST_M_66(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_68(_1, ...) _1, UTIL_MACRO_FIRST_M_67(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_69(_1, ...) _1, UTIL_MACRO_FIRST_M_68(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_70(_1, ...) _1, UTIL_MACRO_FIRST_M_69(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_71(_1, ...) _1, UTIL_MACRO_FIRST_M_70(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_72(_1, ...) _1, UTIL_MACRO_FIRST_M_71(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_73(_1, ...) _1, UTIL_MACRO_FIRST_M_72(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_74(_1, ...) _1, UTIL_MACRO_FIRST_M_73(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_75(_1, ...) _1, UTIL_MACRO_FIRST_M_74(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_76(_1, ...) _1, UTIL_MACRO_FIRST_M_75(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_77(_1, ...) _1, UTIL_MACRO_FIRST_M_76(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_78(_1, ...) _1, UTIL_MACRO_FIRST_M_77(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_79(_1, ...) _1, UTIL_MACRO_FIRST_M_78(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_80(_1, ...) _1, UTIL_MACRO_FIRST_M_79(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_81(_1, ...) _1, UTIL_MACRO_FIRST_M_80(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_82(_1, ...) _1, UTIL_MACRO_FIRST_M_81(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_83(_1, ...) _1, UTIL_MACRO_FIRST_M_82(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_84(_1, ...) _1, UTIL_MACRO_FIRST_M_83(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_85(_1, ...) _1, UTIL_MACRO_FIRST_M_84(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_86(_1, ...) _1, UTIL_MACRO_FIRST_M_85(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_87(_1, ...) _1, UTIL_MACRO_FIRST_M_86(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_88(_1, ...) _1, UTIL_MACRO_FIRST_M_87(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_89(_1, ...) _1, UTIL_MACRO_FIRST_M_88(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_90(_1, ...) _1, UTIL_MACRO_FIRST_M_89(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_91(_1, ...) _1, UTIL_MACRO_FIRST_M_90(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_92(_1, ...) _1, UTIL_MACRO_FIRST_M_91(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_93(_1, ...) _1, UTIL_MACRO_FIRST_M_92(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_94(_1, ...) _1, UTIL_MACRO_FIRST_M_93(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_95(_1, ...) _1, UTIL_MACRO_FIRST_M_94(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_96(_1, ...) _1, UTIL_MACRO_FIRST_M_95(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_97(_1, ...) _1, UTIL_MACRO_FIRST_M_96(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_98(_1, ...) _1, UTIL_MACRO_FIRST_M_97(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_99(_1, ...) _1, UTIL_MACRO_FIRST_M_98(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_100(_1, ...) _1, UTIL_MACRO_FIRST_M_99(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_101(_1, ...) _1, UTIL_MACRO_FIRST_M_100(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_102(_1, ...) _1, UTIL_MACRO_FIRST_M_101(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_103(_1, ...) _1, UTIL_MACRO_FIRST_M_102(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_104(_1, ...) _1, UTIL_MACRO_FIRST_M_103(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_105(_1, ...) _1, UTIL_MACRO_FIRST_M_104(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_106(_1, ...) _1, UTIL_MACRO_FIRST_M_105(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_107(_1, ...) _1, UTIL_MACRO_FIRST_M_106(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_108(_1, ...) _1, UTIL_MACRO_FIRST_M_107(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_109(_1, ...) _1, UTIL_MACRO_FIRST_M_108(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_110(_1, ...) _1, UTIL_MACRO_FIRST_M_109(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_111(_1, ...) _1, UTIL_MACRO_FIRST_M_110(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_112(_1, ...) _1, UTIL_MACRO_FIRST_M_111(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_113(_1, ...) _1, UTIL_MACRO_FIRST_M_112(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_114(_1, ...) _1, UTIL_MACRO_FIRST_M_113(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_115(_1, ...) _1, UTIL_MACRO_FIRST_M_114(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_116(_1, ...) _1, UTIL_MACRO_FIRST_M_115(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_117(_1, ...) _1, UTIL_MACRO_FIRST_M_116(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_118(_1, ...) _1, UTIL_MACRO_FIRST_M_117(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_119(_1, ...) _1, UTIL_MACRO_FIRST_M_118(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_120(_1, ...) _1, UTIL_MACRO_FIRST_M_119(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_121(_1, ...) _1, UTIL_MACRO_FIRST_M_120(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_122(_1, ...) _1, UTIL_MACRO_FIRST_M_121(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_123(_1, ...) _1, UTIL_MACRO_FIRST_M_122(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_124(_1, ...) _1, UTIL_MACRO_FIRST_M_123(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_125(_1, ...) _1, UTIL_MACRO_FIRST_M_124(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_126(_1, ...) _1, UTIL_MACRO_FIRST_M_125(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_127(_1, ...) _1, UTIL_MACRO_FIRST_M_126(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_128(_1, ...) _1, UTIL_MACRO_FIRST_M_127(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_129(_1, ...) _1, UTIL_MACRO_FIRST_M_128(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_130(_1, ...) _1, UTIL_MACRO_FIRST_M_129(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_131(_1, ...) _1, UTIL_MACRO_FIRST_M_130(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_132(_1, ...) _1, UTIL_MACRO_FIRST_M_131(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_133(_1, ...) _1, UTIL_MACRO_FIRST_M_132(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_134(_1, ...) _1, UTIL_MACRO_FIRST_M_133(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_135(_1, ...) _1, UTIL_MACRO_FIRST_M_134(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_136(_1, ...) _1, UTIL_MACRO_FIRST_M_135(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_137(_1, ...) _1, UTIL_MACRO_FIRST_M_136(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_138(_1, ...) _1, UTIL_MACRO_FIRST_M_137(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_139(_1, ...) _1, UTIL_MACRO_FIRST_M_138(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_140(_1, ...) _1, UTIL_MACRO_FIRST_M_139(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_141(_1, ...) _1, UTIL_MACRO_FIRST_M_140(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_142(_1, ...) _1, UTIL_MACRO_FIRST_M_141(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_143(_1, ...) _1, UTIL_MACRO_FIRST_M_142(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_144(_1, ...) _1, UTIL_MACRO_FIRST_M_143(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_145(_1, ...) _1, UTIL_MACRO_FIRST_M_144(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_146(_1, ...) _1, UTIL_MACRO_FIRST_M_145(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_147(_1, ...) _1, UTIL_MACRO_FIRST_M_146(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_148(_1, ...) _1, UTIL_MACRO_FIRST_M_147(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_149(_1, ...) _1, UTIL_MACRO_FIRST_M_148(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_150(_1, ...) _1, UTIL_MACRO_FIRST_M_149(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_151(_1, ...) _1, UTIL_MACRO_FIRST_M_150(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_152(_1, ...) _1, UTIL_MACRO_FIRST_M_151(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_153(_1, ...) _1, UTIL_MACRO_FIRST_M_152(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_154(_1, ...) _1, UTIL_MACRO_FIRST_M_153(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_155(_1, ...) _1, UTIL_MACRO_FIRST_M_154(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_156(_1, ...) _1, UTIL_MACRO_FIRST_M_155(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_157(_1, ...) _1, UTIL_MACRO_FIRST_M_156(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_158(_1, ...) _1, UTIL_MACRO_FIRST_M_157(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_159(_1, ...) _1, UTIL_MACRO_FIRST_M_158(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_160(_1, ...) _1, UTIL_MACRO_FIRST_M_159(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_161(_1, ...) _1, UTIL_MACRO_FIRST_M_160(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_162(_1, ...) _1, UTIL_MACRO_FIRST_M_161(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_163(_1, ...) _1, UTIL_MACRO_FIRST_M_162(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_164(_1, ...) _1, UTIL_MACRO_FIRST_M_163(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_165(_1, ...) _1, UTIL_MACRO_FIRST_M_164(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_166(_1, ...) _1, UTIL_MACRO_FIRST_M_165(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_167(_1, ...) _1, UTIL_MACRO_FIRST_M_166(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_168(_1, ...) _1, UTIL_MACRO_FIRST_M_167(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_169(_1, ...) _1, UTIL_MACRO_FIRST_M_168(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_170(_1, ...) _1, UTIL_MACRO_FIRST_M_169(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_171(_1, ...) _1, UTIL_MACRO_FIRST_M_170(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_172(_1, ...) _1, UTIL_MACRO_FIRST_M_171(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_173(_1, ...) _1, UTIL_MACRO_FIRST_M_172(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_174(_1, ...) _1, UTIL_MACRO_FIRST_M_173(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_175(_1, ...) _1, UTIL_MACRO_FIRST_M_174(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_176(_1, ...) _1, UTIL_MACRO_FIRST_M_175(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_177(_1, ...) _1, UTIL_MACRO_FIRST_M_176(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_178(_1, ...) _1, UTIL_MACRO_FIRST_M_177(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_179(_1, ...) _1, UTIL_MACRO_FIRST_M_178(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_180(_1, ...) _1, UTIL_MACRO_FIRST_M_179(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_181(_1, ...) _1, UTIL_MACRO_FIRST_M_180(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_182(_1, ...) _1, UTIL_MACRO_FIRST_M_181(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_183(_1, ...) _1, UTIL_MACRO_FIRST_M_182(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_184(_1, ...) _1, UTIL_MACRO_FIRST_M_183(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_185(_1, ...) _1, UTIL_MACRO_FIRST_M_184(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_186(_1, ...) _1, UTIL_MACRO_FIRST_M_185(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_187(_1, ...) _1, UTIL_MACRO_FIRST_M_186(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_188(_1, ...) _1, UTIL_MACRO_FIRST_M_187(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_189(_1, ...) _1, UTIL_MACRO_FIRST_M_188(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_190(_1, ...) _1, UTIL_MACRO_FIRST_M_189(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_191(_1, ...) _1, UTIL_MACRO_FIRST_M_190(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_192(_1, ...) _1, UTIL_MACRO_FIRST_M_191(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_193(_1, ...) _1, UTIL_MACRO_FIRST_M_192(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_194(_1, ...) _1, UTIL_MACRO_FIRST_M_193(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_195(_1, ...) _1, UTIL_MACRO_FIRST_M_194(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_196(_1, ...) _1, UTIL_MACRO_FIRST_M_195(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_197(_1, ...) _1, UTIL_MACRO_FIRST_M_196(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_198(_1, ...) _1, UTIL_MACRO_FIRST_M_197(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_199(_1, ...) _1, UTIL_MACRO_FIRST_M_198(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_200(_1, ...) _1, UTIL_MACRO_FIRST_M_199(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_201(_1, ...) _1, UTIL_MACRO_FIRST_M_200(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_202(_1, ...) _1, UTIL_MACRO_FIRST_M_201(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_203(_1, ...) _1, UTIL_MACRO_FIRST_M_202(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_204(_1, ...) _1, UTIL_MACRO_FIRST_M_203(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_205(_1, ...) _1, UTIL_MACRO_FIRST_M_204(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_206(_1, ...) _1, UTIL_MACRO_FIRST_M_205(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_207(_1, ...) _1, UTIL_MACRO_FIRST_M_206(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_208(_1, ...) _1, UTIL_MACRO_FIRST_M_207(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_209(_1, ...) _1, UTIL_MACRO_FIRST_M_208(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_210(_1, ...) _1, UTIL_MACRO_FIRST_M_209(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_211(_1, ...) _1, UTIL_MACRO_FIRST_M_210(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_212(_1, ...) _1, UTIL_MACRO_FIRST_M_211(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_213(_1, ...) _1, UTIL_MACRO_FIRST_M_212(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_214(_1, ...) _1, UTIL_MACRO_FIRST_M_213(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_215(_1, ...) _1, UTIL_MACRO_FIRST_M_214(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_216(_1, ...) _1, UTIL_MACRO_FIRST_M_215(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_217(_1, ...) _1, UTIL_MACRO_FIRST_M_216(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_218(_1, ...) _1, UTIL_MACRO_FIRST_M_217(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_219(_1, ...) _1, UTIL_MACRO_FIRST_M_218(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_220(_1, ...) _1, UTIL_MACRO_FIRST_M_219(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_221(_1, ...) _1, UTIL_MACRO_FIRST_M_220(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_222(_1, ...) _1, UTIL_MACRO_FIRST_M_221(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_223(_1, ...) _1, UTIL_MACRO_FIRST_M_222(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_224(_1, ...) _1, UTIL_MACRO_FIRST_M_223(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_225(_1, ...) _1, UTIL_MACRO_FIRST_M_224(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_226(_1, ...) _1, UTIL_MACRO_FIRST_M_225(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_227(_1, ...) _1, UTIL_MACRO_FIRST_M_226(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_228(_1, ...) _1, UTIL_MACRO_FIRST_M_227(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_229(_1, ...) _1, UTIL_MACRO_FIRST_M_228(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_230(_1, ...) _1, UTIL_MACRO_FIRST_M_229(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_231(_1, ...) _1, UTIL_MACRO_FIRST_M_230(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_232(_1, ...) _1, UTIL_MACRO_FIRST_M_231(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_233(_1, ...) _1, UTIL_MACRO_FIRST_M_232(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_234(_1, ...) _1, UTIL_MACRO_FIRST_M_233(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_235(_1, ...) _1, UTIL_MACRO_FIRST_M_234(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_236(_1, ...) _1, UTIL_MACRO_FIRST_M_235(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_237(_1, ...) _1, UTIL_MACRO_FIRST_M_236(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_238(_1, ...) _1, UTIL_MACRO_FIRST_M_237(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_239(_1, ...) _1, UTIL_MACRO_FIRST_M_238(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_240(_1, ...) _1, UTIL_MACRO_FIRST_M_239(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_241(_1, ...) _1, UTIL_MACRO_FIRST_M_240(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_242(_1, ...) _1, UTIL_MACRO_FIRST_M_241(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_243(_1, ...) _1, UTIL_MACRO_FIRST_M_242(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_244(_1, ...) _1, UTIL_MACRO_FIRST_M_243(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_245(_1, ...) _1, UTIL_MACRO_FIRST_M_244(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_246(_1, ...) _1, UTIL_MACRO_FIRST_M_245(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_247(_1, ...) _1, UTIL_MACRO_FIRST_M_246(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_248(_1, ...) _1, UTIL_MACRO_FIRST_M_247(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_249(_1, ...) _1, UTIL_MACRO_FIRST_M_248(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_250(_1, ...) _1, UTIL_MACRO_FIRST_M_249(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_251(_1, ...) _1, UTIL_MACRO_FIRST_M_250(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_252(_1, ...) _1, UTIL_MACRO_FIRST_M_251(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_253(_1, ...) _1, UTIL_MACRO_FIRST_M_252(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_254(_1, ...) _1, UTIL_MACRO_FIRST_M_253(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_255(_1, ...) _1, UTIL_MACRO_FIRST_M_254(__VA_ARGS__)
+#define UTIL_MACRO_FIRST_M_256(_1, ...) _1, UTIL_MACRO_FIRST_M_255(__VA_ARGS__)
+
+// i + 1 for 0 <= i < 256
+#define UTIL_MACRO_INC_0 1
+#define UTIL_MACRO_INC_1 2
+#define UTIL_MACRO_INC_2 3
+#define UTIL_MACRO_INC_3 4
+#define UTIL_MACRO_INC_4 5
+#define UTIL_MACRO_INC_5 6
+#define UTIL_MACRO_INC_6 7
+#define UTIL_MACRO_INC_7 8
+#define UTIL_MACRO_INC_8 9
+#define UTIL_MACRO_INC_9 10
+#define UTIL_MACRO_INC_10 11
+#define UTIL_MACRO_INC_11 12
+#define UTIL_MACRO_INC_12 13
+#define UTIL_MACRO_INC_13 14
+#define UTIL_MACRO_INC_14 15
+#define UTIL_MACRO_INC_15 16
+#define UTIL_MACRO_INC_16 17
+#define UTIL_MACRO_INC_17 18
+#define UTIL_MACRO_INC_18 19
+#define UTIL_MACRO_INC_19 20
+#define UTIL_MACRO_INC_20 21
+#define UTIL_MACRO_INC_21 22
+#define UTIL_MACRO_INC_22 23
+#define UTIL_MACRO_INC_23 24
+#define UTIL_MACRO_INC_24 25
+#define UTIL_MACRO_INC_25 26
+#define UTIL_MACRO_INC_26 27
+#define UTIL_MACRO_INC_27 28
+#define UTIL_MACRO_INC_28 29
+#define UTIL_MACRO_INC_29 30
+#define UTIL_MACRO_INC_30 31
+#define UTIL_MACRO_INC_31 32
+#define UTIL_MACRO_INC_32 33
+#define UTIL_MACRO_INC_33 34
+#define UTIL_MACRO_INC_34 35
+#define UTIL_MACRO_INC_35 36
+#define UTIL_MACRO_INC_36 37
+#define UTIL_MACRO_INC_37 38
+#define UTIL_MACRO_INC_38 39
+#define UTIL_MACRO_INC_39 40
+#define UTIL_MACRO_INC_40 41
+#define UTIL_MACRO_INC_41 42
+#define UTIL_MACRO_INC_42 43
+#define UTIL_MACRO_INC_43 44
+#define UTIL_MACRO_INC_44 45
+#define UTIL_MACRO_INC_45 46
+#define UTIL_MACRO_INC_46 47
+#define UTIL_MACRO_INC_47 48
+#define UTIL_MACRO_INC_48 49
+#define UTIL_MACRO_INC_49 50
+#define UTIL_MACRO_INC_50 51
+#define UTIL_MACRO_INC_51 52
+#define UTIL_MACRO_INC_52 53
+#define UTIL_MACRO_INC_53 54
+#define UTIL_MACRO_INC_54 55
+#define UTIL_MACRO_INC_55 56
+#define UTIL_MACRO_INC_56 57
+#define UTIL_MACRO_INC_57 58
+#define UTIL_MACRO_INC_58 59
+#define UTIL_MACRO_INC_59 60
+#define UTIL_MACRO_INC_60 61
+#define UTIL_MACRO_INC_61 62
+#define UTIL_MACRO_INC_62 63
+#define UTIL_MACRO_INC_63 64
+#define UTIL_MACRO_INC_64 65
+#define UTIL_MACRO_INC_65 66
+#define UTIL_MACRO_INC_66 67
+#define UTIL_MACRO_INC_67 68
+#define UTIL_MACRO_INC_68 69
+#define UTIL_MACRO_INC_69 70
+#define UTIL_MACRO_INC_70 71
+#define UTIL_MACRO_INC_71 72
+#define UTIL_MACRO_INC_72 73
+#define UTIL_MACRO_INC_73 74
+#define UTIL_MACRO_INC_74 75
+#define UTIL_MACRO_INC_75 76
+#define UTIL_MACRO_INC_76 77
+#define UTIL_MACRO_INC_77 78
+#define UTIL_MACRO_INC_78 79
+#define UTIL_MACRO_INC_79 80
+#define UTIL_MACRO_INC_80 81
+#define UTIL_MACRO_INC_81 82
+#define UTIL_MACRO_INC_82 83
+#define UTIL_MACRO_INC_83 84
+#define UTIL_MACRO_INC_84 85
+#define UTIL_MACRO_INC_85 86
+#define UTIL_MACRO_INC_86 87
+#define UTIL_MACRO_INC_87 88
+#define UTIL_MACRO_INC_88 89
+#define UTIL_MACRO_INC_89 90
+#define UTIL_MACRO_INC_90 91
+#define UTIL_MACRO_INC_91 92
+#define UTIL_MACRO_INC_92 93
+#define UTIL_MACRO_INC_93 94
+#define UTIL_MACRO_INC_94 95
+#define UTIL_MACRO_INC_95 96
+#define UTIL_MACRO_INC_96 97
+#define UTIL_MACRO_INC_97 98
+#define UTIL_MACRO_INC_98 99
+#define UTIL_MACRO_INC_99 100
+#define UTIL_MACRO_INC_100 101
+#define UTIL_MACRO_INC_101 102
+#define UTIL_MACRO_INC_102 103
+#define UTIL_MACRO_INC_103 104
+#define UTIL_MACRO_INC_104 105
+#define UTIL_MACRO_INC_105 106
+#define UTIL_MACRO_INC_106 107
+#define UTIL_MACRO_INC_107 108
+#define UTIL_MACRO_INC_108 109
+#define UTIL_MACRO_INC_109 110
+#define UTIL_MACRO_INC_110 111
+#define UTIL_MACRO_INC_111 112
+#define UTIL_MACRO_INC_112 113
+#define UTIL_MACRO_INC_113 114
+#define UTIL_MACRO_INC_114 115
+#define UTIL_MACRO_INC_115 116
+#define UTIL_MACRO_INC_116 117
+#define UTIL_MACRO_INC_117 118
+#define UTIL_MACRO_INC_118 119
+#define UTIL_MACRO_INC_119 120
+#define UTIL_MACRO_INC_120 121
+#define UTIL_MACRO_INC_121 122
+#define UTIL_MACRO_INC_122 123
+#define UTIL_MACRO_INC_123 124
+#define UTIL_MACRO_INC_124 125
+#define UTIL_MACRO_INC_125 126
+#define UTIL_MACRO_INC_126 127
+#define UTIL_MACRO_INC_127 128
+#define UTIL_MACRO_INC_128 129
+#define UTIL_MACRO_INC_129 130
+#define UTIL_MACRO_INC_130 131
+#define UTIL_MACRO_INC_131 132
+#define UTIL_MACRO_INC_132 133
+#define UTIL_MACRO_INC_133 134
+#define UTIL_MACRO_INC_134 135
+#define UTIL_MACRO_INC_135 136
+#define UTIL_MACRO_INC_136 137
+#define UTIL_MACRO_INC_137 138
+#define UTIL_MACRO_INC_138 139
+#define UTIL_MACRO_INC_139 140
+#define UTIL_MACRO_INC_140 141
+#define UTIL_MACRO_INC_141 142
+#define UTIL_MACRO_INC_142 143
+#define UTIL_MACRO_INC_143 144
+#define UTIL_MACRO_INC_144 145
+#define UTIL_MACRO_INC_145 146
+#define UTIL_MACRO_INC_146 147
+#define UTIL_MACRO_INC_147 148
+#define UTIL_MACRO_INC_148 149
+#define UTIL_MACRO_INC_149 150
+#define UTIL_MACRO_INC_150 151
+#define UTIL_MACRO_INC_151 152
+#define UTIL_MACRO_INC_152 153
+#define UTIL_MACRO_INC_153 154
+#define UTIL_MACRO_INC_154 155
+#define UTIL_MACRO_INC_155 156
+#define UTIL_MACRO_INC_156 157
+#define UTIL_MACRO_INC_157 158
+#define UTIL_MACRO_INC_158 159
+#define UTIL_MACRO_INC_159 160
+#define UTIL_MACRO_INC_160 161
+#define UTIL_MACRO_INC_161 162
+#define UTIL_MACRO_INC_162 163
+#define UTIL_MACRO_INC_163 164
+#define UTIL_MACRO_INC_164 165
+#define UTIL_MACRO_INC_165 166
+#define UTIL_MACRO_INC_166 167
+#define UTIL_MACRO_INC_167 168
+#define UTIL_MACRO_INC_168 169
+#define UTIL_MACRO_INC_169 170
+#define UTIL_MACRO_INC_170 171
+#define UTIL_MACRO_INC_171 172
+#define UTIL_MACRO_INC_172 173
+#define UTIL_MACRO_INC_173 174
+#define UTIL_MACRO_INC_174 175
+#define UTIL_MACRO_INC_175 176
+#define UTIL_MACRO_INC_176 177
+#define UTIL_MACRO_INC_177 178
+#define UTIL_MACRO_INC_178 179
+#define UTIL_MACRO_INC_179 180
+#define UTIL_MACRO_INC_180 181
+#define UTIL_MACRO_INC_181 182
+#define UTIL_MACRO_INC_182 183
+#define UTIL_MACRO_INC_183 184
+#define UTIL_MACRO_INC_184 185
+#define UTIL_MACRO_INC_185 186
+#define UTIL_MACRO_INC_186 187
+#define UTIL_MACRO_INC_187 188
+#define UTIL_MACRO_INC_188 189
+#define UTIL_MACRO_INC_189 190
+#define UTIL_MACRO_INC_190 191
+#define UTIL_MACRO_INC_191 192
+#define UTIL_MACRO_INC_192 193
+#define UTIL_MACRO_INC_193 194
+#define UTIL_MACRO_INC_194 195
+#define UTIL_MACRO_INC_195 196
+#define UTIL_MACRO_INC_196 197
+#define UTIL_MACRO_INC_197 198
+#define UTIL_MACRO_INC_198 199
+#define UTIL_MACRO_INC_199 200
+#define UTIL_MACRO_INC_200 201
+#define UTIL_MACRO_INC_201 202
+#define UTIL_MACRO_INC_202 203
+#define UTIL_MACRO_INC_203 204
+#define UTIL_MACRO_INC_204 205
+#define UTIL_MACRO_INC_205 206
+#define UTIL_MACRO_INC_206 207
+#define UTIL_MACRO_INC_207 208
+#define UTIL_MACRO_INC_208 209
+#define UTIL_MACRO_INC_209 210
+#define UTIL_MACRO_INC_210 211
+#define UTIL_MACRO_INC_211 212
+#define UTIL_MACRO_INC_212 213
+#define UTIL_MACRO_INC_213 214
+#define UTIL_MACRO_INC_214 215
+#define UTIL_MACRO_INC_215 216
+#define UTIL_MACRO_INC_216 217
+#define UTIL_MACRO_INC_217 218
+#define UTIL_MACRO_INC_218 219
+#define UTIL_MACRO_INC_219 220
+#define UTIL_MACRO_INC_220 221
+#define UTIL_MACRO_INC_221 222
+#define UTIL_MACRO_INC_222 223
+#define UTIL_MACRO_INC_223 224
+#define UTIL_MACRO_INC_224 225
+#define UTIL_MACRO_INC_225 226
+#define UTIL_MACRO_INC_226 227
+#define UTIL_MACRO_INC_227 228
+#define UTIL_MACRO_INC_228 229
+#define UTIL_MACRO_INC_229 230
+#define UTIL_MACRO_INC_230 231
+#define UTIL_MACRO_INC_231 232
+#define UTIL_MACRO_INC_232 233
+#define UTIL_MACRO_INC_233 234
+#define UTIL_MACRO_INC_234 235
+#define UTIL_MACRO_INC_235 236
+#define UTIL_MACRO_INC_236 237
+#define UTIL_MACRO_INC_237 238
+#define UTIL_MACRO_INC_238 239
+#define UTIL_MACRO_INC_239 240
+#define UTIL_MACRO_INC_240 241
+#define UTIL_MACRO_INC_241 242
+#define UTIL_MACRO_INC_242 243
+#define UTIL_MACRO_INC_243 244
+#define UTIL_MACRO_INC_244 245
+#define UTIL_MACRO_INC_245 246
+#define UTIL_MACRO_INC_246 247
+#define UTIL_MACRO_INC_247 248
+#define UTIL_MACRO_INC_248 249
+#define UTIL_MACRO_INC_249 250
+#define UTIL_MACRO_INC_250 251
+#define UTIL_MACRO_INC_251 252
+#define UTIL_MACRO_INC_252 253
+#define UTIL_MACRO_INC_253 254
+#define UTIL_MACRO_INC_254 255
+#define UTIL_MACRO_INC_255 256
+#define UTIL_MACRO_INC(i) UTIL_MACRO_CAT(UTIL_MACRO_INC_, i)
+
+// m(x) for every argument x, in order
+#define UTIL_MACRO_FOR_EACH(m, ...) \
+    UTIL_MACRO_CAT(UTIL_MACRO_FOR_EACH_, UTIL_MACRO_COUNT(__VA_ARGS__))(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_1(m, x) m(x)
+#define UTIL_MACRO_FOR_EACH_2(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_1(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_3(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_2(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_4(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_3(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_5(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_4(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_6(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_5(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_7(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_6(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_8(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_7(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_9(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_8(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_10(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_9(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_11(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_10(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_12(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_11(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_13(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_12(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_14(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_13(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_15(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_14(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_16(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_15(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_17(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_16(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_18(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_17(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_19(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_18(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_20(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_19(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_21(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_20(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_22(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_21(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_23(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_22(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_24(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_23(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_25(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_24(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_26(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_25(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_27(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_26(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_28(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_27(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_29(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_28(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_30(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_29(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_31(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_30(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_32(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_31(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_33(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_32(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_34(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_33(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_35(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_34(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_36(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_35(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_37(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_36(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_38(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_37(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_39(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_38(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_40(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_39(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_41(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_40(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_42(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_41(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_43(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_42(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_44(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_43(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_45(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_44(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_46(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_45(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_47(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_46(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_48(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_47(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_49(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_48(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_50(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_49(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_51(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_50(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_52(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_51(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_53(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_52(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_54(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_53(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_55(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_54(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_56(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_55(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_57(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_56(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_58(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_57(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_59(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_58(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_60(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_59(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_61(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_60(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_62(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_61(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_63(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_62(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_64(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_63(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_65(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_64(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_66(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_65(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_67(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_66(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_68(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_67(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_69(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_68(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_70(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_69(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_71(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_70(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_72(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_71(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_73(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_72(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_74(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_73(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_75(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_74(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_76(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_75(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_77(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_76(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_78(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_77(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_79(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_78(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_80(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_79(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_81(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_80(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_82(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_81(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_83(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_82(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_84(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_83(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_85(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_84(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_86(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_85(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_87(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_86(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_88(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_87(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_89(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_88(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_90(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_89(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_91(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_90(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_92(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_91(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_93(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_92(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_94(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_93(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_95(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_94(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_96(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_95(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_97(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_96(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_98(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_97(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_99(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_98(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_100(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_99(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_101(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_100(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_102(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_101(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_103(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_102(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_104(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_103(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_105(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_104(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_106(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_105(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_107(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_106(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_108(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_107(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_109(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_108(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_110(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_109(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_111(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_110(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_112(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_111(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_113(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_112(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_114(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_113(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_115(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_114(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_116(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_115(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_117(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_116(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_118(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_117(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_119(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_118(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_120(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_119(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_121(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_120(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_122(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_121(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_123(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_122(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_124(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_123(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_125(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_124(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_126(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_125(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_127(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_126(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_128(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_127(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_129(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_128(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_130(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_129(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_131(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_130(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_132(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_131(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_133(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_132(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_134(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_133(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_135(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_134(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_136(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_135(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_137(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_136(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_138(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_137(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_139(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_138(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_140(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_139(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_141(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_140(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_142(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_141(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_143(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_142(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_144(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_143(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_145(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_144(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_146(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_145(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_147(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_146(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_148(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_147(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_149(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_148(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_150(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_149(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_151(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_150(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_152(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_151(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_153(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_152(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_154(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_153(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_155(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_154(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_156(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_155(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_157(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_156(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_158(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_157(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_159(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_158(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_160(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_159(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_161(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_160(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_162(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_161(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_163(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_162(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_164(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_163(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_165(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_164(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_166(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_165(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_167(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_166(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_168(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_167(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_169(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_168(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_170(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_169(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_171(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_170(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_172(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_171(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_173(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_172(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_174(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_173(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_175(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_174(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_176(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_175(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_177(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_176(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_178(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_177(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_179(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_178(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_180(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_179(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_181(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_180(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_182(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_181(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_183(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_182(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_184(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_183(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_185(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_184(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_186(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_185(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_187(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_186(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_188(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_187(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_189(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_188(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_190(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_189(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_191(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_190(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_192(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_191(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_193(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_192(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_194(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_193(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_195(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_194(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_196(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_195(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_197(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_196(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_198(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_197(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_199(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_198(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_200(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_199(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_201(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_200(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_202(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_201(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_203(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_202(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_204(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_203(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_205(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_204(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_206(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_205(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_207(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_206(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_208(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_207(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_209(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_208(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_210(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_209(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_211(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_210(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_212(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_211(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_213(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_212(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_214(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_213(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_215(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_214(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_216(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_215(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_217(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_216(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_218(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_217(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_219(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_218(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_220(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_219(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_221(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_220(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_222(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_221(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_223(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_222(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_224(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_223(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_225(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_224(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_226(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_225(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_227(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_226(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_228(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_227(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_229(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_228(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_230(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_229(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_231(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_230(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_232(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_231(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_233(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_232(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_234(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_233(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_235(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_234(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_236(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_235(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_237(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_236(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_238(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_237(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_239(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_238(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_240(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_239(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_241(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_240(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_242(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_241(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_243(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_242(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_244(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_243(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_245(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_244(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_246(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_245(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_247(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_246(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_248(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_247(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_249(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_248(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_250(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_249(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_251(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_250(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_252(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_251(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_253(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_252(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_254(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_253(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_255(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_254(m, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_256(m, x, ...) m(x) UTIL_MACRO_FOR_EACH_255(m, __VA_ARGS__)
+
+// m(i, x) for every argument x, where i is its zero-based position
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX(m, ...) \
+    UTIL_MACRO_CAT(UTIL_MACRO_FOR_EACH_WITH_INDEX_, UTIL_MACRO_COUNT(__VA_ARGS__))(m, 0, __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_1(m, i, x) m(i, x)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_2(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_1(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_3(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_2(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_4(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_3(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_5(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_4(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_6(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_5(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_7(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_6(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_8(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_7(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_9(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_8(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_10(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_9(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_11(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_10(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_12(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_11(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_13(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_12(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_14(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_13(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_15(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_14(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_16(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_15(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_17(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_16(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_18(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_17(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_19(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_18(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_20(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_19(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_21(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_20(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_22(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_21(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_23(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_22(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_24(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_23(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_25(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_24(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_26(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_25(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_27(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_26(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_28(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_27(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_29(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_28(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_30(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_29(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_31(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_30(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_32(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_31(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_33(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_32(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_34(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_33(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_35(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_34(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_36(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_35(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_37(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_36(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_38(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_37(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_39(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_38(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_40(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_39(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_41(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_40(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_42(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_41(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_43(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_42(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_44(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_43(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_45(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_44(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_46(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_45(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_47(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_46(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_48(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_47(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_49(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_48(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_50(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_49(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_51(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_50(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_52(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_51(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_53(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_52(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_54(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_53(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_55(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_54(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_56(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_55(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_57(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_56(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_58(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_57(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_59(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_58(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_60(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_59(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_61(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_60(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_62(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_61(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_63(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_62(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_64(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_63(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_65(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_64(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_66(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_65(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_67(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_66(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_68(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_67(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_69(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_68(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_70(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_69(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_71(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_70(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_72(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_71(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_73(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_72(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_74(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_73(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_75(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_74(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_76(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_75(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_77(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_76(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_78(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_77(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_79(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_78(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_80(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_79(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_81(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_80(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_82(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_81(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_83(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_82(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_84(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_83(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_85(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_84(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_86(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_85(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_87(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_86(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_88(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_87(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_89(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_88(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_90(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_89(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_91(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_90(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_92(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_91(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_93(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_92(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_94(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_93(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_95(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_94(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_96(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_95(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_97(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_96(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_98(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_97(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_99(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_98(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_100(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_99(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_101(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_100(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_102(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_101(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_103(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_102(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_104(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_103(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_105(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_104(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_106(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_105(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_107(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_106(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_108(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_107(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_109(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_108(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_110(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_109(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_111(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_110(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_112(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_111(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_113(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_112(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_114(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_113(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_115(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_114(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_116(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_115(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_117(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_116(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_118(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_117(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_119(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_118(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_120(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_119(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_121(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_120(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_122(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_121(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_123(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_122(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_124(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_123(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_125(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_124(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_126(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_125(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_127(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_126(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_128(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_127(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_129(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_128(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_130(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_129(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_131(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_130(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_132(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_131(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_133(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_132(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_134(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_133(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_135(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_134(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_136(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_135(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_137(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_136(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_138(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_137(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_139(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_138(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_140(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_139(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_141(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_140(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_142(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_141(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_143(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_142(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_144(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_143(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_145(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_144(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_146(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_145(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_147(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_146(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_148(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_147(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_149(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_148(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_150(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_149(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_151(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_150(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_152(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_151(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_153(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_152(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_154(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_153(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_155(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_154(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_156(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_155(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_157(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_156(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_158(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_157(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_159(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_158(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_160(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_159(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_161(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_160(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_162(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_161(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_163(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_162(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_164(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_163(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_165(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_164(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_166(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_165(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_167(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_166(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_168(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_167(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_169(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_168(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_170(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_169(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_171(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_170(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_172(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_171(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_173(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_172(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_174(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_173(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_175(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_174(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_176(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_175(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_177(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_176(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_178(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_177(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_179(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_178(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_180(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_179(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_181(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_180(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_182(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_181(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_183(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_182(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_184(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_183(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_185(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_184(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_186(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_185(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_187(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_186(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_188(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_187(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_189(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_188(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_190(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_189(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_191(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_190(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_192(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_191(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_193(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_192(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_194(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_193(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_195(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_194(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_196(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_195(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_197(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_196(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_198(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_197(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_199(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_198(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_200(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_199(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_201(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_200(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_202(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_201(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_203(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_202(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_204(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_203(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_205(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_204(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_206(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_205(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_207(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_206(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_208(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_207(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_209(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_208(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_210(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_209(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_211(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_210(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_212(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_211(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_213(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_212(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_214(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_213(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_215(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_214(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_216(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_215(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_217(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_216(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_218(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_217(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_219(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_218(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_220(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_219(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_221(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_220(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_222(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_221(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_223(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_222(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_224(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_223(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_225(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_224(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_226(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_225(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_227(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_226(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_228(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_227(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_229(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_228(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_230(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_229(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_231(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_230(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_232(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_231(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_233(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_232(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_234(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_233(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_235(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_234(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_236(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_235(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_237(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_236(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_238(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_237(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_239(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_238(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_240(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_239(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_241(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_240(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_242(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_241(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_243(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_242(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_244(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_243(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_245(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_244(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_246(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_245(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_247(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_246(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_248(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_247(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_249(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_248(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_250(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_249(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_251(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_250(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_252(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_251(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_253(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_252(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_254(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_253(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_255(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_254(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+#define UTIL_MACRO_FOR_EACH_WITH_INDEX_256(m, i, x, ...) m(i, x) UTIL_MACRO_FOR_EACH_WITH_INDEX_255(m, UTIL_MACRO_INC(i), __VA_ARGS__)
+
+// m(x1), m(x2), ... for the arguments x1, x2, ...
+#define UTIL_MACRO_MAP(m, ...) \
+    UTIL_MACRO_CAT(UTIL_MACRO_MAP_, UTIL_MACRO_COUNT(__VA_ARGS__))(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_1(m, x) m(x)
+#define UTIL_MACRO_MAP_2(m, x, ...) m(x), UTIL_MACRO_MAP_1(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_3(m, x, ...) m(x), UTIL_MACRO_MAP_2(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_4(m, x, ...) m(x), UTIL_MACRO_MAP_3(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_5(m, x, ...) m(x), UTIL_MACRO_MAP_4(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_6(m, x, ...) m(x), UTIL_MACRO_MAP_5(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_7(m, x, ...) m(x), UTIL_MACRO_MAP_6(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_8(m, x, ...) m(x), UTIL_MACRO_MAP_7(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_9(m, x, ...) m(x), UTIL_MACRO_MAP_8(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_10(m, x, ...) m(x), UTIL_MACRO_MAP_9(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_11(m, x, ...) m(x), UTIL_MACRO_MAP_10(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_12(m, x, ...) m(x), UTIL_MACRO_MAP_11(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_13(m, x, ...) m(x), UTIL_MACRO_MAP_12(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_14(m, x, ...) m(x), UTIL_MACRO_MAP_13(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_15(m, x, ...) m(x), UTIL_MACRO_MAP_14(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_16(m, x, ...) m(x), UTIL_MACRO_MAP_15(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_17(m, x, ...) m(x), UTIL_MACRO_MAP_16(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_18(m, x, ...) m(x), UTIL_MACRO_MAP_17(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_19(m, x, ...) m(x), UTIL_MACRO_MAP_18(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_20(m, x, ...) m(x), UTIL_MACRO_MAP_19(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_21(m, x, ...) m(x), UTIL_MACRO_MAP_20(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_22(m, x, ...) m(x), UTIL_MACRO_MAP_21(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_23(m, x, ...) m(x), UTIL_MACRO_MAP_22(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_24(m, x, ...) m(x), UTIL_MACRO_MAP_23(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_25(m, x, ...) m(x), UTIL_MACRO_MAP_24(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_26(m, x, ...) m(x), UTIL_MACRO_MAP_25(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_27(m, x, ...) m(x), UTIL_MACRO_MAP_26(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_28(m, x, ...) m(x), UTIL_MACRO_MAP_27(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_29(m, x, ...) m(x), UTIL_MACRO_MAP_28(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_30(m, x, ...) m(x), UTIL_MACRO_MAP_29(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_31(m, x, ...) m(x), UTIL_MACRO_MAP_30(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_32(m, x, ...) m(x), UTIL_MACRO_MAP_31(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_33(m, x, ...) m(x), UTIL_MACRO_MAP_32(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_34(m, x, ...) m(x), UTIL_MACRO_MAP_33(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_35(m, x, ...) m(x), UTIL_MACRO_MAP_34(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_36(m, x, ...) m(x), UTIL_MACRO_MAP_35(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_37(m, x, ...) m(x), UTIL_MACRO_MAP_36(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_38(m, x, ...) m(x), UTIL_MACRO_MAP_37(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_39(m, x, ...) m(x), UTIL_MACRO_MAP_38(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_40(m, x, ...) m(x), UTIL_MACRO_MAP_39(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_41(m, x, ...) m(x), UTIL_MACRO_MAP_40(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_42(m, x, ...) m(x), UTIL_MACRO_MAP_41(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_43(m, x, ...) m(x), UTIL_MACRO_MAP_42(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_44(m, x, ...) m(x), UTIL_MACRO_MAP_43(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_45(m, x, ...) m(x), UTIL_MACRO_MAP_44(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_46(m, x, ...) m(x), UTIL_MACRO_MAP_45(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_47(m, x, ...) m(x), UTIL_MACRO_MAP_46(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_48(m, x, ...) m(x), UTIL_MACRO_MAP_47(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_49(m, x, ...) m(x), UTIL_MACRO_MAP_48(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_50(m, x, ...) m(x), UTIL_MACRO_MAP_49(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_51(m, x, ...) m(x), UTIL_MACRO_MAP_50(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_52(m, x, ...) m(x), UTIL_MACRO_MAP_51(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_53(m, x, ...) m(x), UTIL_MACRO_MAP_52(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_54(m, x, ...) m(x), UTIL_MACRO_MAP_53(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_55(m, x, ...) m(x), UTIL_MACRO_MAP_54(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_56(m, x, ...) m(x), UTIL_MACRO_MAP_55(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_57(m, x, ...) m(x), UTIL_MACRO_MAP_56(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_58(m, x, ...) m(x), UTIL_MACRO_MAP_57(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_59(m, x, ...) m(x), UTIL_MACRO_MAP_58(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_60(m, x, ...) m(x), UTIL_MACRO_MAP_59(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_61(m, x, ...) m(x), UTIL_MACRO_MAP_60(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_62(m, x, ...) m(x), UTIL_MACRO_MAP_61(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_63(m, x, ...) m(x), UTIL_MACRO_MAP_62(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_64(m, x, ...) m(x), UTIL_MACRO_MAP_63(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_65(m, x, ...) m(x), UTIL_MACRO_MAP_64(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_66(m, x, ...) m(x), UTIL_MACRO_MAP_65(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_67(m, x, ...) m(x), UTIL_MACRO_MAP_66(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_68(m, x, ...) m(x), UTIL_MACRO_MAP_67(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_69(m, x, ...) m(x), UTIL_MACRO_MAP_68(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_70(m, x, ...) m(x), UTIL_MACRO_MAP_69(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_71(m, x, ...) m(x), UTIL_MACRO_MAP_70(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_72(m, x, ...) m(x), UTIL_MACRO_MAP_71(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_73(m, x, ...) m(x), UTIL_MACRO_MAP_72(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_74(m, x, ...) m(x), UTIL_MACRO_MAP_73(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_75(m, x, ...) m(x), UTIL_MACRO_MAP_74(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_76(m, x, ...) m(x), UTIL_MACRO_MAP_75(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_77(m, x, ...) m(x), UTIL_MACRO_MAP_76(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_78(m, x, ...) m(x), UTIL_MACRO_MAP_77(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_79(m, x, ...) m(x), UTIL_MACRO_MAP_78(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_80(m, x, ...) m(x), UTIL_MACRO_MAP_79(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_81(m, x, ...) m(x), UTIL_MACRO_MAP_80(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_82(m, x, ...) m(x), UTIL_MACRO_MAP_81(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_83(m, x, ...) m(x), UTIL_MACRO_MAP_82(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_84(m, x, ...) m(x), UTIL_MACRO_MAP_83(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_85(m, x, ...) m(x), UTIL_MACRO_MAP_84(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_86(m, x, ...) m(x), UTIL_MACRO_MAP_85(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_87(m, x, ...) m(x), UTIL_MACRO_MAP_86(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_88(m, x, ...) m(x), UTIL_MACRO_MAP_87(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_89(m, x, ...) m(x), UTIL_MACRO_MAP_88(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_90(m, x, ...) m(x), UTIL_MACRO_MAP_89(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_91(m, x, ...) m(x), UTIL_MACRO_MAP_90(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_92(m, x, ...) m(x), UTIL_MACRO_MAP_91(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_93(m, x, ...) m(x), UTIL_MACRO_MAP_92(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_94(m, x, ...) m(x), UTIL_MACRO_MAP_93(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_95(m, x, ...) m(x), UTIL_MACRO_MAP_94(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_96(m, x, ...) m(x), UTIL_MACRO_MAP_95(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_97(m, x, ...) m(x), UTIL_MACRO_MAP_96(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_98(m, x, ...) m(x), UTIL_MACRO_MAP_97(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_99(m, x, ...) m(x), UTIL_MACRO_MAP_98(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_100(m, x, ...) m(x), UTIL_MACRO_MAP_99(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_101(m, x, ...) m(x), UTIL_MACRO_MAP_100(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_102(m, x, ...) m(x), UTIL_MACRO_MAP_101(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_103(m, x, ...) m(x), UTIL_MACRO_MAP_102(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_104(m, x, ...) m(x), UTIL_MACRO_MAP_103(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_105(m, x, ...) m(x), UTIL_MACRO_MAP_104(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_106(m, x, ...) m(x), UTIL_MACRO_MAP_105(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_107(m, x, ...) m(x), UTIL_MACRO_MAP_106(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_108(m, x, ...) m(x), UTIL_MACRO_MAP_107(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_109(m, x, ...) m(x), UTIL_MACRO_MAP_108(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_110(m, x, ...) m(x), UTIL_MACRO_MAP_109(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_111(m, x, ...) m(x), UTIL_MACRO_MAP_110(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_112(m, x, ...) m(x), UTIL_MACRO_MAP_111(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_113(m, x, ...) m(x), UTIL_MACRO_MAP_112(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_114(m, x, ...) m(x), UTIL_MACRO_MAP_113(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_115(m, x, ...) m(x), UTIL_MACRO_MAP_114(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_116(m, x, ...) m(x), UTIL_MACRO_MAP_115(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_117(m, x, ...) m(x), UTIL_MACRO_MAP_116(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_118(m, x, ...) m(x), UTIL_MACRO_MAP_117(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_119(m, x, ...) m(x), UTIL_MACRO_MAP_118(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_120(m, x, ...) m(x), UTIL_MACRO_MAP_119(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_121(m, x, ...) m(x), UTIL_MACRO_MAP_120(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_122(m, x, ...) m(x), UTIL_MACRO_MAP_121(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_123(m, x, ...) m(x), UTIL_MACRO_MAP_122(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_124(m, x, ...) m(x), UTIL_MACRO_MAP_123(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_125(m, x, ...) m(x), UTIL_MACRO_MAP_124(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_126(m, x, ...) m(x), UTIL_MACRO_MAP_125(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_127(m, x, ...) m(x), UTIL_MACRO_MAP_126(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_128(m, x, ...) m(x), UTIL_MACRO_MAP_127(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_129(m, x, ...) m(x), UTIL_MACRO_MAP_128(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_130(m, x, ...) m(x), UTIL_MACRO_MAP_129(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_131(m, x, ...) m(x), UTIL_MACRO_MAP_130(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_132(m, x, ...) m(x), UTIL_MACRO_MAP_131(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_133(m, x, ...) m(x), UTIL_MACRO_MAP_132(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_134(m, x, ...) m(x), UTIL_MACRO_MAP_133(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_135(m, x, ...) m(x), UTIL_MACRO_MAP_134(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_136(m, x, ...) m(x), UTIL_MACRO_MAP_135(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_137(m, x, ...) m(x), UTIL_MACRO_MAP_136(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_138(m, x, ...) m(x), UTIL_MACRO_MAP_137(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_139(m, x, ...) m(x), UTIL_MACRO_MAP_138(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_140(m, x, ...) m(x), UTIL_MACRO_MAP_139(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_141(m, x, ...) m(x), UTIL_MACRO_MAP_140(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_142(m, x, ...) m(x), UTIL_MACRO_MAP_141(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_143(m, x, ...) m(x), UTIL_MACRO_MAP_142(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_144(m, x, ...) m(x), UTIL_MACRO_MAP_143(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_145(m, x, ...) m(x), UTIL_MACRO_MAP_144(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_146(m, x, ...) m(x), UTIL_MACRO_MAP_145(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_147(m, x, ...) m(x), UTIL_MACRO_MAP_146(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_148(m, x, ...) m(x), UTIL_MACRO_MAP_147(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_149(m, x, ...) m(x), UTIL_MACRO_MAP_148(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_150(m, x, ...) m(x), UTIL_MACRO_MAP_149(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_151(m, x, ...) m(x), UTIL_MACRO_MAP_150(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_152(m, x, ...) m(x), UTIL_MACRO_MAP_151(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_153(m, x, ...) m(x), UTIL_MACRO_MAP_152(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_154(m, x, ...) m(x), UTIL_MACRO_MAP_153(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_155(m, x, ...) m(x), UTIL_MACRO_MAP_154(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_156(m, x, ...) m(x), UTIL_MACRO_MAP_155(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_157(m, x, ...) m(x), UTIL_MACRO_MAP_156(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_158(m, x, ...) m(x), UTIL_MACRO_MAP_157(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_159(m, x, ...) m(x), UTIL_MACRO_MAP_158(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_160(m, x, ...) m(x), UTIL_MACRO_MAP_159(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_161(m, x, ...) m(x), UTIL_MACRO_MAP_160(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_162(m, x, ...) m(x), UTIL_MACRO_MAP_161(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_163(m, x, ...) m(x), UTIL_MACRO_MAP_162(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_164(m, x, ...) m(x), UTIL_MACRO_MAP_163(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_165(m, x, ...) m(x), UTIL_MACRO_MAP_164(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_166(m, x, ...) m(x), UTIL_MACRO_MAP_165(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_167(m, x, ...) m(x), UTIL_MACRO_MAP_166(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_168(m, x, ...) m(x), UTIL_MACRO_MAP_167(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_169(m, x, ...) m(x), UTIL_MACRO_MAP_168(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_170(m, x, ...) m(x), UTIL_MACRO_MAP_169(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_171(m, x, ...) m(x), UTIL_MACRO_MAP_170(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_172(m, x, ...) m(x), UTIL_MACRO_MAP_171(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_173(m, x, ...) m(x), UTIL_MACRO_MAP_172(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_174(m, x, ...) m(x), UTIL_MACRO_MAP_173(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_175(m, x, ...) m(x), UTIL_MACRO_MAP_174(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_176(m, x, ...) m(x), UTIL_MACRO_MAP_175(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_177(m, x, ...) m(x), UTIL_MACRO_MAP_176(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_178(m, x, ...) m(x), UTIL_MACRO_MAP_177(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_179(m, x, ...) m(x), UTIL_MACRO_MAP_178(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_180(m, x, ...) m(x), UTIL_MACRO_MAP_179(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_181(m, x, ...) m(x), UTIL_MACRO_MAP_180(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_182(m, x, ...) m(x), UTIL_MACRO_MAP_181(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_183(m, x, ...) m(x), UTIL_MACRO_MAP_182(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_184(m, x, ...) m(x), UTIL_MACRO_MAP_183(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_185(m, x, ...) m(x), UTIL_MACRO_MAP_184(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_186(m, x, ...) m(x), UTIL_MACRO_MAP_185(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_187(m, x, ...) m(x), UTIL_MACRO_MAP_186(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_188(m, x, ...) m(x), UTIL_MACRO_MAP_187(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_189(m, x, ...) m(x), UTIL_MACRO_MAP_188(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_190(m, x, ...) m(x), UTIL_MACRO_MAP_189(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_191(m, x, ...) m(x), UTIL_MACRO_MAP_190(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_192(m, x, ...) m(x), UTIL_MACRO_MAP_191(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_193(m, x, ...) m(x), UTIL_MACRO_MAP_192(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_194(m, x, ...) m(x), UTIL_MACRO_MAP_193(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_195(m, x, ...) m(x), UTIL_MACRO_MAP_194(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_196(m, x, ...) m(x), UTIL_MACRO_MAP_195(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_197(m, x, ...) m(x), UTIL_MACRO_MAP_196(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_198(m, x, ...) m(x), UTIL_MACRO_MAP_197(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_199(m, x, ...) m(x), UTIL_MACRO_MAP_198(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_200(m, x, ...) m(x), UTIL_MACRO_MAP_199(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_201(m, x, ...) m(x), UTIL_MACRO_MAP_200(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_202(m, x, ...) m(x), UTIL_MACRO_MAP_201(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_203(m, x, ...) m(x), UTIL_MACRO_MAP_202(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_204(m, x, ...) m(x), UTIL_MACRO_MAP_203(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_205(m, x, ...) m(x), UTIL_MACRO_MAP_204(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_206(m, x, ...) m(x), UTIL_MACRO_MAP_205(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_207(m, x, ...) m(x), UTIL_MACRO_MAP_206(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_208(m, x, ...) m(x), UTIL_MACRO_MAP_207(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_209(m, x, ...) m(x), UTIL_MACRO_MAP_208(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_210(m, x, ...) m(x), UTIL_MACRO_MAP_209(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_211(m, x, ...) m(x), UTIL_MACRO_MAP_210(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_212(m, x, ...) m(x), UTIL_MACRO_MAP_211(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_213(m, x, ...) m(x), UTIL_MACRO_MAP_212(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_214(m, x, ...) m(x), UTIL_MACRO_MAP_213(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_215(m, x, ...) m(x), UTIL_MACRO_MAP_214(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_216(m, x, ...) m(x), UTIL_MACRO_MAP_215(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_217(m, x, ...) m(x), UTIL_MACRO_MAP_216(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_218(m, x, ...) m(x), UTIL_MACRO_MAP_217(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_219(m, x, ...) m(x), UTIL_MACRO_MAP_218(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_220(m, x, ...) m(x), UTIL_MACRO_MAP_219(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_221(m, x, ...) m(x), UTIL_MACRO_MAP_220(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_222(m, x, ...) m(x), UTIL_MACRO_MAP_221(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_223(m, x, ...) m(x), UTIL_MACRO_MAP_222(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_224(m, x, ...) m(x), UTIL_MACRO_MAP_223(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_225(m, x, ...) m(x), UTIL_MACRO_MAP_224(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_226(m, x, ...) m(x), UTIL_MACRO_MAP_225(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_227(m, x, ...) m(x), UTIL_MACRO_MAP_226(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_228(m, x, ...) m(x), UTIL_MACRO_MAP_227(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_229(m, x, ...) m(x), UTIL_MACRO_MAP_228(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_230(m, x, ...) m(x), UTIL_MACRO_MAP_229(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_231(m, x, ...) m(x), UTIL_MACRO_MAP_230(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_232(m, x, ...) m(x), UTIL_MACRO_MAP_231(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_233(m, x, ...) m(x), UTIL_MACRO_MAP_232(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_234(m, x, ...) m(x), UTIL_MACRO_MAP_233(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_235(m, x, ...) m(x), UTIL_MACRO_MAP_234(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_236(m, x, ...) m(x), UTIL_MACRO_MAP_235(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_237(m, x, ...) m(x), UTIL_MACRO_MAP_236(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_238(m, x, ...) m(x), UTIL_MACRO_MAP_237(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_239(m, x, ...) m(x), UTIL_MACRO_MAP_238(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_240(m, x, ...) m(x), UTIL_MACRO_MAP_239(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_241(m, x, ...) m(x), UTIL_MACRO_MAP_240(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_242(m, x, ...) m(x), UTIL_MACRO_MAP_241(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_243(m, x, ...) m(x), UTIL_MACRO_MAP_242(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_244(m, x, ...) m(x), UTIL_MACRO_MAP_243(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_245(m, x, ...) m(x), UTIL_MACRO_MAP_244(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_246(m, x, ...) m(x), UTIL_MACRO_MAP_245(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_247(m, x, ...) m(x), UTIL_MACRO_MAP_246(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_248(m, x, ...) m(x), UTIL_MACRO_MAP_247(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_249(m, x, ...) m(x), UTIL_MACRO_MAP_248(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_250(m, x, ...) m(x), UTIL_MACRO_MAP_249(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_251(m, x, ...) m(x), UTIL_MACRO_MAP_250(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_252(m, x, ...) m(x), UTIL_MACRO_MAP_251(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_253(m, x, ...) m(x), UTIL_MACRO_MAP_252(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_254(m, x, ...) m(x), UTIL_MACRO_MAP_253(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_255(m, x, ...) m(x), UTIL_MACRO_MAP_254(m, __VA_ARGS__)
+#define UTIL_MACRO_MAP_256(m, x, ...) m(x), UTIL_MACRO_MAP_255(m, __VA_ARGS__)
+
+// The arguments in reverse order
+#define UTIL_MACRO_REVERSE(...) \
+    UTIL_MACRO_CAT(UTIL_MACRO_REVERSE_, UTIL_MACRO_COUNT(__VA_ARGS__))(__VA_ARGS__)
+#define UTIL_MACRO_REVERSE_1(x) x
+#define UTIL_MACRO_REVERSE_2(x, ...) UTIL_MACRO_REVERSE_1(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_3(x, ...) UTIL_MACRO_REVERSE_2(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_4(x, ...) UTIL_MACRO_REVERSE_3(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_5(x, ...) UTIL_MACRO_REVERSE_4(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_6(x, ...) UTIL_MACRO_REVERSE_5(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_7(x, ...) UTIL_MACRO_REVERSE_6(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_8(x, ...) UTIL_MACRO_REVERSE_7(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_9(x, ...) UTIL_MACRO_REVERSE_8(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_10(x, ...) UTIL_MACRO_REVERSE_9(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_11(x, ...) UTIL_MACRO_REVERSE_10(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_12(x, ...) UTIL_MACRO_REVERSE_11(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_13(x, ...) UTIL_MACRO_REVERSE_12(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_14(x, ...) UTIL_MACRO_REVERSE_13(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_15(x, ...) UTIL_MACRO_REVERSE_14(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_16(x, ...) UTIL_MACRO_REVERSE_15(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_17(x, ...) UTIL_MACRO_REVERSE_16(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_18(x, ...) UTIL_MACRO_REVERSE_17(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_19(x, ...) UTIL_MACRO_REVERSE_18(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_20(x, ...) UTIL_MACRO_REVERSE_19(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_21(x, ...) UTIL_MACRO_REVERSE_20(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_22(x, ...) UTIL_MACRO_REVERSE_21(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_23(x, ...) UTIL_MACRO_REVERSE_22(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_24(x, ...) UTIL_MACRO_REVERSE_23(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_25(x, ...) UTIL_MACRO_REVERSE_24(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_26(x, ...) UTIL_MACRO_REVERSE_25(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_27(x, ...) UTIL_MACRO_REVERSE_26(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_28(x, ...) UTIL_MACRO_REVERSE_27(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_29(x, ...) UTIL_MACRO_REVERSE_28(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_30(x, ...) UTIL_MACRO_REVERSE_29(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_31(x, ...) UTIL_MACRO_REVERSE_30(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_32(x, ...) UTIL_MACRO_REVERSE_31(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_33(x, ...) UTIL_MACRO_REVERSE_32(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_34(x, ...) UTIL_MACRO_REVERSE_33(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_35(x, ...) UTIL_MACRO_REVERSE_34(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_36(x, ...) UTIL_MACRO_REVERSE_35(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_37(x, ...) UTIL_MACRO_REVERSE_36(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_38(x, ...) UTIL_MACRO_REVERSE_37(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_39(x, ...) UTIL_MACRO_REVERSE_38(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_40(x, ...) UTIL_MACRO_REVERSE_39(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_41(x, ...) UTIL_MACRO_REVERSE_40(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_42(x, ...) UTIL_MACRO_REVERSE_41(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_43(x, ...) UTIL_MACRO_REVERSE_42(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_44(x, ...) UTIL_MACRO_REVERSE_43(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_45(x, ...) UTIL_MACRO_REVERSE_44(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_46(x, ...) UTIL_MACRO_REVERSE_45(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_47(x, ...) UTIL_MACRO_REVERSE_46(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_48(x, ...) UTIL_MACRO_REVERSE_47(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_49(x, ...) UTIL_MACRO_REVERSE_48(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_50(x, ...) UTIL_MACRO_REVERSE_49(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_51(x, ...) UTIL_MACRO_REVERSE_50(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_52(x, ...) UTIL_MACRO_REVERSE_51(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_53(x, ...) UTIL_MACRO_REVERSE_52(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_54(x, ...) UTIL_MACRO_REVERSE_53(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_55(x, ...) UTIL_MACRO_REVERSE_54(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_56(x, ...) UTIL_MACRO_REVERSE_55(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_57(x, ...) UTIL_MACRO_REVERSE_56(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_58(x, ...) UTIL_MACRO_REVERSE_57(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_59(x, ...) UTIL_MACRO_REVERSE_58(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_60(x, ...) UTIL_MACRO_REVERSE_59(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_61(x, ...) UTIL_MACRO_REVERSE_60(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_62(x, ...) UTIL_MACRO_REVERSE_61(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_63(x, ...) UTIL_MACRO_REVERSE_62(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_64(x, ...) UTIL_MACRO_REVERSE_63(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_65(x, ...) UTIL_MACRO_REVERSE_64(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_66(x, ...) UTIL_MACRO_REVERSE_65(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_67(x, ...) UTIL_MACRO_REVERSE_66(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_68(x, ...) UTIL_MACRO_REVERSE_67(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_69(x, ...) UTIL_MACRO_REVERSE_68(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_70(x, ...) UTIL_MACRO_REVERSE_69(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_71(x, ...) UTIL_MACRO_REVERSE_70(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_72(x, ...) UTIL_MACRO_REVERSE_71(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_73(x, ...) UTIL_MACRO_REVERSE_72(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_74(x, ...) UTIL_MACRO_REVERSE_73(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_75(x, ...) UTIL_MACRO_REVERSE_74(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_76(x, ...) UTIL_MACRO_REVERSE_75(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_77(x, ...) UTIL_MACRO_REVERSE_76(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_78(x, ...) UTIL_MACRO_REVERSE_77(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_79(x, ...) UTIL_MACRO_REVERSE_78(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_80(x, ...) UTIL_MACRO_REVERSE_79(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_81(x, ...) UTIL_MACRO_REVERSE_80(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_82(x, ...) UTIL_MACRO_REVERSE_81(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_83(x, ...) UTIL_MACRO_REVERSE_82(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_84(x, ...) UTIL_MACRO_REVERSE_83(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_85(x, ...) UTIL_MACRO_REVERSE_84(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_86(x, ...) UTIL_MACRO_REVERSE_85(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_87(x, ...) UTIL_MACRO_REVERSE_86(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_88(x, ...) UTIL_MACRO_REVERSE_87(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_89(x, ...) UTIL_MACRO_REVERSE_88(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_90(x, ...) UTIL_MACRO_REVERSE_89(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_91(x, ...) UTIL_MACRO_REVERSE_90(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_92(x, ...) UTIL_MACRO_REVERSE_91(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_93(x, ...) UTIL_MACRO_REVERSE_92(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_94(x, ...) UTIL_MACRO_REVERSE_93(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_95(x, ...) UTIL_MACRO_REVERSE_94(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_96(x, ...) UTIL_MACRO_REVERSE_95(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_97(x, ...) UTIL_MACRO_REVERSE_96(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_98(x, ...) UTIL_MACRO_REVERSE_97(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_99(x, ...) UTIL_MACRO_REVERSE_98(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_100(x, ...) UTIL_MACRO_REVERSE_99(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_101(x, ...) UTIL_MACRO_REVERSE_100(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_102(x, ...) UTIL_MACRO_REVERSE_101(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_103(x, ...) UTIL_MACRO_REVERSE_102(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_104(x, ...) UTIL_MACRO_REVERSE_103(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_105(x, ...) UTIL_MACRO_REVERSE_104(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_106(x, ...) UTIL_MACRO_REVERSE_105(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_107(x, ...) UTIL_MACRO_REVERSE_106(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_108(x, ...) UTIL_MACRO_REVERSE_107(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_109(x, ...) UTIL_MACRO_REVERSE_108(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_110(x, ...) UTIL_MACRO_REVERSE_109(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_111(x, ...) UTIL_MACRO_REVERSE_110(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_112(x, ...) UTIL_MACRO_REVERSE_111(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_113(x, ...) UTIL_MACRO_REVERSE_112(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_114(x, ...) UTIL_MACRO_REVERSE_113(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_115(x, ...) UTIL_MACRO_REVERSE_114(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_116(x, ...) UTIL_MACRO_REVERSE_115(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_117(x, ...) UTIL_MACRO_REVERSE_116(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_118(x, ...) UTIL_MACRO_REVERSE_117(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_119(x, ...) UTIL_MACRO_REVERSE_118(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_120(x, ...) UTIL_MACRO_REVERSE_119(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_121(x, ...) UTIL_MACRO_REVERSE_120(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_122(x, ...) UTIL_MACRO_REVERSE_121(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_123(x, ...) UTIL_MACRO_REVERSE_122(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_124(x, ...) UTIL_MACRO_REVERSE_123(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_125(x, ...) UTIL_MACRO_REVERSE_124(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_126(x, ...) UTIL_MACRO_REVERSE_125(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_127(x, ...) UTIL_MACRO_REVERSE_126(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_128(x, ...) UTIL_MACRO_REVERSE_127(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_129(x, ...) UTIL_MACRO_REVERSE_128(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_130(x, ...) UTIL_MACRO_REVERSE_129(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_131(x, ...) UTIL_MACRO_REVERSE_130(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_132(x, ...) UTIL_MACRO_REVERSE_131(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_133(x, ...) UTIL_MACRO_REVERSE_132(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_134(x, ...) UTIL_MACRO_REVERSE_133(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_135(x, ...) UTIL_MACRO_REVERSE_134(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_136(x, ...) UTIL_MACRO_REVERSE_135(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_137(x, ...) UTIL_MACRO_REVERSE_136(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_138(x, ...) UTIL_MACRO_REVERSE_137(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_139(x, ...) UTIL_MACRO_REVERSE_138(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_140(x, ...) UTIL_MACRO_REVERSE_139(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_141(x, ...) UTIL_MACRO_REVERSE_140(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_142(x, ...) UTIL_MACRO_REVERSE_141(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_143(x, ...) UTIL_MACRO_REVERSE_142(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_144(x, ...) UTIL_MACRO_REVERSE_143(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_145(x, ...) UTIL_MACRO_REVERSE_144(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_146(x, ...) UTIL_MACRO_REVERSE_145(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_147(x, ...) UTIL_MACRO_REVERSE_146(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_148(x, ...) UTIL_MACRO_REVERSE_147(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_149(x, ...) UTIL_MACRO_REVERSE_148(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_150(x, ...) UTIL_MACRO_REVERSE_149(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_151(x, ...) UTIL_MACRO_REVERSE_150(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_152(x, ...) UTIL_MACRO_REVERSE_151(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_153(x, ...) UTIL_MACRO_REVERSE_152(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_154(x, ...) UTIL_MACRO_REVERSE_153(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_155(x, ...) UTIL_MACRO_REVERSE_154(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_156(x, ...) UTIL_MACRO_REVERSE_155(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_157(x, ...) UTIL_MACRO_REVERSE_156(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_158(x, ...) UTIL_MACRO_REVERSE_157(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_159(x, ...) UTIL_MACRO_REVERSE_158(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_160(x, ...) UTIL_MACRO_REVERSE_159(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_161(x, ...) UTIL_MACRO_REVERSE_160(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_162(x, ...) UTIL_MACRO_REVERSE_161(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_163(x, ...) UTIL_MACRO_REVERSE_162(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_164(x, ...) UTIL_MACRO_REVERSE_163(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_165(x, ...) UTIL_MACRO_REVERSE_164(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_166(x, ...) UTIL_MACRO_REVERSE_165(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_167(x, ...) UTIL_MACRO_REVERSE_166(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_168(x, ...) UTIL_MACRO_REVERSE_167(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_169(x, ...) UTIL_MACRO_REVERSE_168(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_170(x, ...) UTIL_MACRO_REVERSE_169(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_171(x, ...) UTIL_MACRO_REVERSE_170(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_172(x, ...) UTIL_MACRO_REVERSE_171(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_173(x, ...) UTIL_MACRO_REVERSE_172(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_174(x, ...) UTIL_MACRO_REVERSE_173(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_175(x, ...) UTIL_MACRO_REVERSE_174(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_176(x, ...) UTIL_MACRO_REVERSE_175(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_177(x, ...) UTIL_MACRO_REVERSE_176(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_178(x, ...) UTIL_MACRO_REVERSE_177(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_179(x, ...) UTIL_MACRO_REVERSE_178(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_180(x, ...) UTIL_MACRO_REVERSE_179(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_181(x, ...) UTIL_MACRO_REVERSE_180(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_182(x, ...) UTIL_MACRO_REVERSE_181(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_183(x, ...) UTIL_MACRO_REVERSE_182(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_184(x, ...) UTIL_MACRO_REVERSE_183(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_185(x, ...) UTIL_MACRO_REVERSE_184(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_186(x, ...) UTIL_MACRO_REVERSE_185(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_187(x, ...) UTIL_MACRO_REVERSE_186(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_188(x, ...) UTIL_MACRO_REVERSE_187(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_189(x, ...) UTIL_MACRO_REVERSE_188(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_190(x, ...) UTIL_MACRO_REVERSE_189(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_191(x, ...) UTIL_MACRO_REVERSE_190(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_192(x, ...) UTIL_MACRO_REVERSE_191(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_193(x, ...) UTIL_MACRO_REVERSE_192(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_194(x, ...) UTIL_MACRO_REVERSE_193(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_195(x, ...) UTIL_MACRO_REVERSE_194(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_196(x, ...) UTIL_MACRO_REVERSE_195(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_197(x, ...) UTIL_MACRO_REVERSE_196(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_198(x, ...) UTIL_MACRO_REVERSE_197(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_199(x, ...) UTIL_MACRO_REVERSE_198(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_200(x, ...) UTIL_MACRO_REVERSE_199(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_201(x, ...) UTIL_MACRO_REVERSE_200(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_202(x, ...) UTIL_MACRO_REVERSE_201(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_203(x, ...) UTIL_MACRO_REVERSE_202(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_204(x, ...) UTIL_MACRO_REVERSE_203(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_205(x, ...) UTIL_MACRO_REVERSE_204(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_206(x, ...) UTIL_MACRO_REVERSE_205(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_207(x, ...) UTIL_MACRO_REVERSE_206(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_208(x, ...) UTIL_MACRO_REVERSE_207(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_209(x, ...) UTIL_MACRO_REVERSE_208(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_210(x, ...) UTIL_MACRO_REVERSE_209(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_211(x, ...) UTIL_MACRO_REVERSE_210(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_212(x, ...) UTIL_MACRO_REVERSE_211(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_213(x, ...) UTIL_MACRO_REVERSE_212(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_214(x, ...) UTIL_MACRO_REVERSE_213(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_215(x, ...) UTIL_MACRO_REVERSE_214(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_216(x, ...) UTIL_MACRO_REVERSE_215(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_217(x, ...) UTIL_MACRO_REVERSE_216(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_218(x, ...) UTIL_MACRO_REVERSE_217(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_219(x, ...) UTIL_MACRO_REVERSE_218(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_220(x, ...) UTIL_MACRO_REVERSE_219(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_221(x, ...) UTIL_MACRO_REVERSE_220(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_222(x, ...) UTIL_MACRO_REVERSE_221(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_223(x, ...) UTIL_MACRO_REVERSE_222(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_224(x, ...) UTIL_MACRO_REVERSE_223(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_225(x, ...) UTIL_MACRO_REVERSE_224(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_226(x, ...) UTIL_MACRO_REVERSE_225(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_227(x, ...) UTIL_MACRO_REVERSE_226(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_228(x, ...) UTIL_MACRO_REVERSE_227(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_229(x, ...) UTIL_MACRO_REVERSE_228(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_230(x, ...) UTIL_MACRO_REVERSE_229(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_231(x, ...) UTIL_MACRO_REVERSE_230(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_232(x, ...) UTIL_MACRO_REVERSE_231(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_233(x, ...) UTIL_MACRO_REVERSE_232(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_234(x, ...) UTIL_MACRO_REVERSE_233(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_235(x, ...) UTIL_MACRO_REVERSE_234(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_236(x, ...) UTIL_MACRO_REVERSE_235(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_237(x, ...) UTIL_MACRO_REVERSE_236(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_238(x, ...) UTIL_MACRO_REVERSE_237(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_239(x, ...) UTIL_MACRO_REVERSE_238(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_240(x, ...) UTIL_MACRO_REVERSE_239(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_241(x, ...) UTIL_MACRO_REVERSE_240(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_242(x, ...) UTIL_MACRO_REVERSE_241(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_243(x, ...) UTIL_MACRO_REVERSE_242(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_244(x, ...) UTIL_MACRO_REVERSE_243(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_245(x, ...) UTIL_MACRO_REVERSE_244(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_246(x, ...) UTIL_MACRO_REVERSE_245(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_247(x, ...) UTIL_MACRO_REVERSE_246(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_248(x, ...) UTIL_MACRO_REVERSE_247(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_249(x, ...) UTIL_MACRO_REVERSE_248(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_250(x, ...) UTIL_MACRO_REVERSE_249(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_251(x, ...) UTIL_MACRO_REVERSE_250(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_252(x, ...) UTIL_MACRO_REVERSE_251(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_253(x, ...) UTIL_MACRO_REVERSE_252(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_254(x, ...) UTIL_MACRO_REVERSE_253(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_255(x, ...) UTIL_MACRO_REVERSE_254(__VA_ARGS__), x
+#define UTIL_MACRO_REVERSE_256(x, ...) UTIL_MACRO_REVERSE_255(__VA_ARGS__), x
 
 // clang-format on
 
-#endif // UTIL_MACRO_H
\ No newline at end of file
+#endif // UTIL_MACRO_H